@@ -0,0 +1,142 @@
+//
+//  ThreadScaling.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】ThreadScaling.cpp
+//【功能模块和目的】批量推理多线程扩展性基准程序：对随机全连接网络
+//       分别以1～N个线程执行InferenceBatch，报告吞吐量、加速比与并行效率
+//【用法】独立编译运行，不参与主程序构建：
+//       g++ -std=c++17 -O2 -pthread Benchmark/ThreadScaling.cpp Network/*.cpp -o scaling
+//       ./scaling [最大线程数，默认为硬件线程数] [样本数，默认4096]
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】2026/10/18 MakeNetwork改为在调用者的网络上原地构造，避免按值返回时拷贝
+//------------------------------------------------------------------------------
+
+// Network类所属头文件
+#include "../Network/Network.hpp"
+// Layer类所属头文件
+#include "../Network/Layer.hpp"
+// Neuron类所属头文件
+#include "../Network/Neuron.hpp"
+// Synapse类所属头文件
+#include "../Network/Synapse.hpp"
+// 计时所需头文件
+#include <chrono>
+// 随机数所需头文件
+#include <random>
+// 输入输出流所需头文件
+#include <iostream>
+// 格式化输出所需头文件
+#include <iomanip>
+// std::fabs、std::sqrt所需头文件
+#include <cmath>
+// std::stoul所需头文件
+#include <string>
+// std::thread::hardware_concurrency所需头文件
+#include <thread>
+
+// 函数名：MakeNetwork
+// 功能：在空网络上构造全连接网络，隐藏层使用Sigmoid，输出层线性，权重按扇入缩放。
+//       Network自定义了拷贝赋值而没有移动构造，按值返回会使用已弃用的隐式拷贝构造，故原地构造
+// 入口参数：const std::vector<size_t>& sizes 各层神经元数, unsigned seed 随机种子
+// 出口参数：Network& network 构造好的网络
+// 返回值：无
+static void MakeNetwork(Network& network, const std::vector<size_t>& sizes, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<std::vector<std::shared_ptr<Neuron>>> layers;
+    size_t index{0};
+    for (size_t l = 0; l < sizes.size(); ++l) {
+        auto layer = std::make_shared<Layer>(l);
+        network.AddLayer(layer);
+        layers.emplace_back();
+        const int activation = (l == 0 || l + 1 == sizes.size()) ? 0 : 1;
+        for (size_t i = 0; i < sizes[l]; ++i) {
+            auto neuron = std::make_shared<Neuron>(l == 0 ? 0.0 : 0.1 * uniform(rng), activation);
+            neuron->SetIndex(index++);
+            layer->AddNeuron(neuron);
+            layers.back().push_back(neuron);
+        }
+    }
+    for (const auto& neuron : layers.front()) {
+        network.SetInputMarker(neuron);
+    }
+    for (const auto& neuron : layers.back()) {
+        network.SetOutputMarker(neuron);
+    }
+    for (size_t l = 1; l < layers.size(); ++l) {
+        const double scale = 1.0 / std::sqrt(static_cast<double>(sizes[l - 1]));
+        for (const auto& target : layers[l]) {
+            for (const auto& source : layers[l - 1]) {
+                auto synapse = std::make_shared<Synapse>(source, target, scale * uniform(rng));
+                source->AddAxonOutput(synapse);
+                target->AddDendrite(synapse);
+            }
+        }
+    }
+    network.Touch();
+}
+
+// 函数名：main
+// 功能：测量1～N线程的批量推理吞吐量并校验结果与单线程一致
+// 入口参数：int argc, char* argv[] 命令行参数
+// 出口参数：无
+// 返回值：int 0表示成功，结果不一致时返回1
+int main(int argc, char* argv[]) {
+    size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    size_t batch{4096};
+    if (argc > 1) {
+        maxThreads = std::max<size_t>(1, std::stoul(argv[1]));
+    }
+    if (argc > 2) {
+        batch = std::max<size_t>(1, std::stoul(argv[2]));
+    }
+    const std::vector<size_t> sizes{256, 512, 512, 10};
+    Network network;
+    MakeNetwork(network, sizes, 1);
+    CompiledNetwork plan = network.Compile();
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<double> input(batch * plan.GetInputCount());
+    for (auto& value : input) {
+        value = uniform(rng);
+    }
+    std::vector<double> reference(batch * plan.GetOutputCount());
+    std::vector<double> output(reference.size());
+    plan.InferenceBatch(input.data(), batch, reference.data());
+
+    std::cout << "network 256-512-512-10, batch " << batch << std::endl;
+    std::cout << "threads  samples/s  speedup  efficiency" << std::endl;
+    double baseline{0.0};
+    for (size_t threads = 1; threads <= maxThreads; ++threads) {
+        plan.SetThreadCount(threads);
+        // 预热一次，使线程池与缓存就绪
+        plan.InferenceBatch(input.data(), batch, output.data());
+        const int repeat{5};
+        auto begin = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; ++r) {
+            plan.InferenceBatch(input.data(), batch, output.data());
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+        for (size_t i = 0; i < output.size(); ++i) {
+            if (std::fabs(output[i] - reference[i]) > 1e-12) {
+                std::cerr << "Mismatch with " << threads << " threads" << std::endl;
+                return 1;
+            }
+        }
+        const double throughput = repeat * batch / elapsed.count();
+        if (threads == 1) {
+            baseline = throughput;
+        }
+        const double speedup = throughput / baseline;
+        std::cout << std::setw(7) << threads << "  "
+                  << std::setw(9) << std::fixed << std::setprecision(0) << throughput << "  "
+                  << std::setw(7) << std::setprecision(2) << speedup << "  "
+                  << std::setw(9) << std::setprecision(1) << 100.0 * speedup / threads << "%"
+                  << std::endl;
+    }
+    return 0;
+}
@@ -17,6 +17,8 @@
 #include "../Network/Network_ANN_Importer.hpp"
 // Network_ANN_Exporter类所属头文件
 #include "../Network/Network_ANN_Exporter.hpp"
+// Network_HPP_Exporter类所属头文件
+#include "../Network/Network_HPP_Exporter.hpp"
 
 // 单例实例初始化
 std::shared_ptr<Controller> Controller::m_pControllerIntance = nullptr;
@@ -39,7 +41,8 @@ const std::string Controller::RES_STR[] = {
     "DUPLICATE_IMPORTER_ERROR",
     "DUPLICATE_EXPORTER_ERROR",
     "ADD_FAILED",
-    "UNKNOWN_ERROR"
+    "UNKNOWN_ERROR",
+    "INPUT_DATA_ERROR"
 };
 
 // 函数名：GetInstance
@@ -75,6 +78,7 @@ void Controller::RegisterImportersAndExporters() {
     try {
         //导出器注册
         Network_Exporter::Register<Network_ANN_Exporter>();
+        Network_Exporter::Register<Network_HPP_Exporter>();
         Network_Importer::Register<Network_ANN_Importer>();
     } catch (...) {
         // 重复注册会抛出异常，但这里不做处理
@@ -413,6 +417,147 @@ Controller::RES Controller::InferenceOnCurrentNetwork(const std::vector<double>&
     }
 }
 
+// 函数名：InferenceBatchOnCurrentNetwork
+// 功能：执行批量推理
+// 入口参数：const double* in 行主序输入矩阵，size_t batch 样本数
+// 出口参数：double* out 行主序输出矩阵
+// 返回值：Controller::RES
+Controller::RES Controller::InferenceBatchOnCurrentNetwork(const double* in, 
+                                                           size_t batch, 
+                                                           double* out) {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    
+    try {
+        m_Networks[m_CurrentNetworkIndex]->InferenceBatch(in, batch, out);
+        return RES::OK;
+    } catch (const std::exception& e) {
+        std::cerr << "Inference Error: " << e.what() << std::endl;
+        return RES::NETWORK_VALIDATION_ERROR;
+    }
+}
+
+// 函数名：InferenceStreamOnCurrentNetwork
+// 功能：执行流式批量推理，逐批读取输入流并写出结果
+// 入口参数：std::istream& Input, StreamInference::FORMAT InputFormat 输入流及其格式
+//          StreamInference::FORMAT OutputFormat 输出格式, size_t BatchSize 批大小
+// 出口参数：std::ostream& Output 输出流, size_t& Rows 处理的样本数（仅成功时写入）
+// 返回值：Controller::RES
+Controller::RES Controller::InferenceStreamOnCurrentNetwork(std::istream& Input,
+                                                            StreamInference::FORMAT InputFormat,
+                                                            std::ostream& Output,
+                                                            StreamInference::FORMAT OutputFormat,
+                                                            size_t BatchSize, size_t& Rows) {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    if (!m_Networks[m_CurrentNetworkIndex]->IsValid()) {
+        return RES::NETWORK_VALIDATION_ERROR;
+    }
+    try {
+        StreamInference stream(*m_Networks[m_CurrentNetworkIndex], BatchSize);
+        Rows = stream.Run(Input, InputFormat, Output, OutputFormat);
+        return RES::OK;
+    } catch (const std::exception& e) {
+        std::cerr << "Inference Error: " << e.what() << std::endl;
+        return RES::INPUT_DATA_ERROR;
+    }
+}
+
+// 函数名：SetInferenceThreadCountOfCurrentNetwork
+// 功能：设置当前网络批量推理的线程数
+// 入口参数：size_t ThreadCount 线程数（含调用线程）
+// 出口参数：无
+// 返回值：Controller::RES
+Controller::RES Controller::SetInferenceThreadCountOfCurrentNetwork(size_t ThreadCount) {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    if (ThreadCount == 0) {
+        return RES::OPERATION_NOT_ALLOWED;
+    }
+    m_Networks[m_CurrentNetworkIndex]->SetThreadCount(ThreadCount);
+    return RES::OK;
+}
+
+// 函数名：SetActivationApproximationOfCurrentNetwork
+// 功能：设置当前网络编译计划中Sigmoid、Tanh的近似方式
+// 入口参数：ActivationFunction::APPROXIMATION Approximation 近似方式
+// 出口参数：无
+// 返回值：Controller::RES
+Controller::RES Controller::SetActivationApproximationOfCurrentNetwork(
+    ActivationFunction::APPROXIMATION Approximation) {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    m_Networks[m_CurrentNetworkIndex]->SetActivationApproximation(Approximation);
+    return RES::OK;
+}
+
+// 函数名：SetInferenceCacheCapacityOfCurrentNetwork
+// 功能：设置当前网络推理结果缓存容量
+// 入口参数：size_t Capacity 记录数，0表示关闭缓存
+// 出口参数：无
+// 返回值：Controller::RES
+Controller::RES Controller::SetInferenceCacheCapacityOfCurrentNetwork(size_t Capacity) {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    m_Networks[m_CurrentNetworkIndex]->SetCacheCapacity(Capacity);
+    return RES::OK;
+}
+
+// 函数名：GetInferenceCacheStatisticsOfCurrentNetwork
+// 功能：获取当前网络推理结果缓存统计
+// 入口参数：无
+// 出口参数：InferenceCache::Statistics& Statistics 命中、未命中等统计
+// 返回值：Controller::RES
+Controller::RES Controller::GetInferenceCacheStatisticsOfCurrentNetwork(
+    InferenceCache::Statistics& Statistics) const {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    Statistics = m_Networks[m_CurrentNetworkIndex]->GetCacheStatistics();
+    return RES::OK;
+}
+
+// 函数名：FoldLinearLayersOfCurrentNetwork
+// 功能：对当前网络做线性折叠优化，推理结果不变
+// 入口参数：无
+// 出口参数：NetworkOptimizer::Report& Report 删除的神经元、突触数与计算量变化
+// 返回值：Controller::RES
+Controller::RES Controller::FoldLinearLayersOfCurrentNetwork(NetworkOptimizer::Report& Report) {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    if (!m_Networks[m_CurrentNetworkIndex]->IsValid()) {
+        return RES::NETWORK_VALIDATION_ERROR;
+    }
+    Report = NetworkOptimizer::FoldLinear(*m_Networks[m_CurrentNetworkIndex]);
+    return RES::OK;
+}
+
+// 函数名：PruneCurrentNetwork
+// 功能：对当前网络剪枝
+// 入口参数：double Threshold 权重阈值，0表示只删除零权重突触
+// 出口参数：NetworkOptimizer::Report& Report 删除的神经元、突触数与计算量变化
+// 返回值：Controller::RES
+Controller::RES Controller::PruneCurrentNetwork(double Threshold,
+                                                NetworkOptimizer::Report& Report) {
+    if (m_Networks.empty() || m_CurrentNetworkIndex >= m_Networks.size()) {
+        return RES::NETWORK_INDEX_ERROR;
+    }
+    if (!(Threshold >= 0.0)) {
+        return RES::OPERATION_NOT_ALLOWED;
+    }
+    if (!m_Networks[m_CurrentNetworkIndex]->IsValid()) {
+        return RES::NETWORK_VALIDATION_ERROR;
+    }
+    Report = NetworkOptimizer::Prune(*m_Networks[m_CurrentNetworkIndex], Threshold);
+    return RES::OK;
+}
+
 // 函数名：GetNetworks
 // 功能：获取神经网络列表的指针
 // 入口参数：输入层神经元的输入值
@@ -24,6 +24,10 @@
 #include "../Network/Neuron.hpp"
 //Synapse类所属头文件
 #include "../Network/Synapse.hpp"
+//NetworkOptimizer类所属头文件
+#include "../Network/NetworkOptimizer.hpp"
+//StreamInference类所属头文件
+#include "../Network/StreamInference.hpp"
 //std::vector所属头文件
 #include <vector>
 //std::shared_ptr所属头文件
@@ -56,6 +60,11 @@
 //    显示统计信息（显示网络中层总数，神经元总数和突触总数）
 //    验证网络的合理性
 //    执行推理
+//    执行批量推理
+//    执行流式批量推理（CSV或二进制输入输出流）
+//    设置推理结果缓存容量、获取缓存统计
+//    线性折叠优化
+//    剪枝优化
 //    当前网络索引（只读）
 //【开发者及日期】 孙李智 2025/7/16
 //【更改记录】
@@ -100,7 +109,9 @@ public:
         // 添加失败
         ADD_FAILED = 15,
         //未知错误
-        UNKNOWN_ERROR = 16
+        UNKNOWN_ERROR = 16,
+        //输入数据格式错误
+        INPUT_DATA_ERROR = 17
     };
 
 // 神经网络信息
@@ -181,6 +192,27 @@ using SynapseInfoList = std::vector<SynapseInfo>;
     RES ValidateCurrentNetwork();
     // 对指定网络执行推理
     RES InferenceOnCurrentNetwork(const std::vector<double>& input);
+    // 对指定网络执行批量推理（行主序输入、输出矩阵）
+    RES InferenceBatchOnCurrentNetwork(const double* in, size_t batch, double* out);
+    // 对指定网络执行流式批量推理，读完输入流为止，Rows返回处理的样本数
+    RES InferenceStreamOnCurrentNetwork(std::istream& Input,
+                                        StreamInference::FORMAT InputFormat,
+                                        std::ostream& Output,
+                                        StreamInference::FORMAT OutputFormat,
+                                        size_t BatchSize, size_t& Rows);
+    // 设置指定网络批量推理的线程数
+    RES SetInferenceThreadCountOfCurrentNetwork(size_t ThreadCount);
+    // 设置指定网络编译计划中Sigmoid、Tanh的近似方式
+    RES SetActivationApproximationOfCurrentNetwork(ActivationFunction::APPROXIMATION Approximation);
+    // 设置指定网络推理结果缓存容量，0表示关闭缓存
+    RES SetInferenceCacheCapacityOfCurrentNetwork(size_t Capacity);
+    // 获取指定网络推理结果缓存统计
+    RES GetInferenceCacheStatisticsOfCurrentNetwork(
+        InferenceCache::Statistics& Statistics) const;
+    // 对指定网络做线性折叠优化，消去线性激活的中间神经元
+    RES FoldLinearLayersOfCurrentNetwork(NetworkOptimizer::Report& Report);
+    // 对指定网络剪枝，删除|权重|不超过阈值的突触与对输出无贡献的神经元
+    RES PruneCurrentNetwork(double Threshold, NetworkOptimizer::Report& Report);
     //获取神经网络列表的指针
     std::vector<std::shared_ptr<Network>> GetNetworks();
 
@@ -9,6 +9,7 @@
 //【功能模块和目的】激活函数类的实现
 //【开发者及日期】孙李智 2024/7/13
 //【更改记录】
+//            2026/10/18 增加Sigmoid、Tanh的查表与有理近似模式
 //------------------------------------------------------------------------------
 
 // 激活函数类头文件
@@ -17,32 +18,366 @@
 #include<cmath>    
 // 异常基类头文件   
 #include<stdexcept>   
+// std::min、std::max所属头文件
+#include<algorithm>
+// std::vector所属头文件
+#include<vector>
+
+//------------------------------------------------------------------------------
+// 向量化数学函数
+// exp采用Cephes的范围约化 + (3,3)阶Padé近似，相对误差约2e-16；
+// tanh在|x|<0.625时采用Cephes有理近似，其余区间由exp近似求得，
+// 绝对误差约2e-16。标量版本与向量版本算法完全一致，保证尾部元素结果相同
+//------------------------------------------------------------------------------
+
+// exp输入截断范围，保证2^n的指数位不溢出
+static constexpr double EXP_HI = 709.0;
+static constexpr double EXP_LO = -708.0;
+// log2(e)
+static constexpr double LOG2E = 1.4426950408889634074;
+// ln2拆分为高低两部分，减小范围约化误差
+static constexpr double LN2_HI = 6.93145751953125E-1;
+static constexpr double LN2_LO = 1.42860682030941723212E-6;
+// exp的Padé近似系数
+static constexpr double EXP_P0 = 1.26177193074810590878E-4;
+static constexpr double EXP_P1 = 3.02994407707441961300E-2;
+static constexpr double EXP_P2 = 9.99999999999999999910E-1;
+static constexpr double EXP_Q0 = 3.00198505138664455042E-6;
+static constexpr double EXP_Q1 = 2.52448340349684104192E-3;
+static constexpr double EXP_Q2 = 2.27265548208155028766E-1;
+static constexpr double EXP_Q3 = 2.00000000000000000009E0;
+// tanh小区间有理近似系数及分界点
+static constexpr double TANH_SMALL = 0.625;
+static constexpr double TANH_P0 = -9.64399179425052238628E-1;
+static constexpr double TANH_P1 = -9.92877231001918586564E1;
+static constexpr double TANH_P2 = -1.61468768441708447952E3;
+static constexpr double TANH_Q0 = 1.12811678491632931402E2;
+static constexpr double TANH_Q1 = 2.23548839060100448583E3;
+static constexpr double TANH_Q2 = 4.84406305325125486048E3;
+
+// 函数名：ExpApprox
+// 功能：exp的标量近似，与向量版本算法一致
+// 入口参数：double x
+// 出口参数：无
+// 返回值：exp(x)近似值
+static double ExpApprox(double x) {
+    x = std::min(std::max(x, EXP_LO), EXP_HI);
+    double n = std::nearbyint(x * LOG2E);
+    double r = x - n * LN2_HI - n * LN2_LO;
+    double rr = r * r;
+    double px = r * ((EXP_P0 * rr + EXP_P1) * rr + EXP_P2);
+    double qx = ((EXP_Q0 * rr + EXP_Q1) * rr + EXP_Q2) * rr + EXP_Q3;
+    return std::ldexp(1.0 + 2.0 * px / (qx - px), static_cast<int>(n));
+}
+
+// 函数名：TanhApprox
+// 功能：tanh的标量近似，与向量版本算法一致
+// 入口参数：double x
+// 出口参数：无
+// 返回值：tanh(x)近似值
+static double TanhApprox(double x) {
+    double z = x * x;
+    if (std::fabs(x) < TANH_SMALL) {
+        double p = (TANH_P0 * z + TANH_P1) * z + TANH_P2;
+        double q = ((z + TANH_Q0) * z + TANH_Q1) * z + TANH_Q2;
+        return x + x * z * p / q;
+    }
+    double t = 1.0 - 2.0 / (ExpApprox(2.0 * std::fabs(x)) + 1.0);
+    return std::copysign(t, x);
+}
+
+//------------------------------------------------------------------------------
+// 快速近似模式
+// 查表：tanh在[0, TABLE_RANGE]上按1/TABLE_STEPS等距取样，线性插值；
+// 有理：输入截断到±TANH_CLAMP后按13/6阶奇有理函数计算，系数为单精度
+// 极小化极大拟合（与Eigen的快速tanh相同）。Sigmoid均由tanh(x/2)得到
+//------------------------------------------------------------------------------
+
+// 查表覆盖的区间[0, TABLE_RANGE]与每单位区间的取样数
+static constexpr double TABLE_RANGE = 8.0;
+static constexpr size_t TABLE_STEPS = 256;
+static constexpr size_t TABLE_SIZE = static_cast<size_t>(TABLE_RANGE) * TABLE_STEPS + 1;
+// 有理近似的输入截断点，此处分子/分母恰好舍入为1
+static constexpr double TANH_CLAMP = 7.90531110763549805;
+// 有理近似分子系数（x的奇次幂）
+static constexpr double TANH_A1 = 4.89352455891786E-3;
+static constexpr double TANH_A3 = 6.37261928875436E-4;
+static constexpr double TANH_A5 = 1.48572235717979E-5;
+static constexpr double TANH_A7 = 5.12229709037114E-8;
+static constexpr double TANH_A9 = -8.60467152213735E-11;
+static constexpr double TANH_A11 = 2.00018790482477E-13;
+static constexpr double TANH_A13 = -2.76076847742355E-16;
+// 有理近似分母系数（x的偶次幂）
+static constexpr double TANH_B0 = 4.89352518554385E-3;
+static constexpr double TANH_B2 = 2.26843463243900E-3;
+static constexpr double TANH_B4 = 1.18534705686654E-4;
+static constexpr double TANH_B6 = 1.19825839466702E-6;
+
+// 函数名：TanhTable
+// 功能：获取tanh取样表，首次调用时以std::tanh生成（局部静态变量保证线程安全）
+// 入口参数：无
+// 出口参数：无
+// 返回值：TABLE_SIZE个取样值的首地址
+static const double* TanhTable() {
+    static const std::vector<double> TABLE = [] {
+        std::vector<double> table(TABLE_SIZE);
+        for (size_t i = 0; i < TABLE_SIZE; ++i) {
+            table[i] = std::tanh(static_cast<double>(i) / static_cast<double>(TABLE_STEPS));
+        }
+        return table;
+    }();
+    return TABLE.data();
+}
+
+// 函数名：TanhLookup
+// 功能：tanh的查表近似，|x|不小于TABLE_RANGE时取±1，NaN原样返回
+// 入口参数：const double* table 取样表, double x
+// 出口参数：无
+// 返回值：tanh(x)近似值
+static inline double TanhLookup(const double* table, double x) {
+    const double a = std::fabs(x);
+    if (!(a < TABLE_RANGE)) {
+        return std::isnan(x) ? x : std::copysign(1.0, x);
+    }
+    const double t = a * static_cast<double>(TABLE_STEPS);
+    const size_t i = static_cast<size_t>(t);
+    const double f = t - static_cast<double>(i);
+    return std::copysign(table[i] + f * (table[i + 1] - table[i]), x);
+}
+
+// 函数名：TanhRational
+// 功能：tanh的有理近似，NaN经截断后仍为NaN
+// 入口参数：double x
+// 出口参数：无
+// 返回值：tanh(x)近似值
+static inline double TanhRational(double x) {
+    const double c = std::min(std::max(x, -TANH_CLAMP), TANH_CLAMP);
+    const double z = c * c;
+    double p = ((((((TANH_A13 * z + TANH_A11) * z + TANH_A9) * z + TANH_A7) * z
+                 + TANH_A5) * z + TANH_A3) * z + TANH_A1) * c;
+    double q = ((TANH_B6 * z + TANH_B4) * z + TANH_B2) * z + TANH_B0;
+    return p / q;
+}
+
+#if defined(__AVX2__) || defined(__SSE2__)
+// SSE/AVX内建函数头文件
+#include <immintrin.h>
+#define ANN_SIMD_ACTIVATION 1
+#endif
+
+#if defined(__AVX2__)
+// AVX2路径：每次处理4个double
+typedef __m256d VecD;
+static constexpr size_t VEC_WIDTH = 4;
+static inline VecD VLoad(const double* p) { return _mm256_loadu_pd(p); }
+static inline void VStore(double* p, VecD v) { _mm256_storeu_pd(p, v); }
+static inline VecD VSet(double x) { return _mm256_set1_pd(x); }
+static inline VecD VAdd(VecD a, VecD b) { return _mm256_add_pd(a, b); }
+static inline VecD VSub(VecD a, VecD b) { return _mm256_sub_pd(a, b); }
+static inline VecD VMul(VecD a, VecD b) { return _mm256_mul_pd(a, b); }
+static inline VecD VDiv(VecD a, VecD b) { return _mm256_div_pd(a, b); }
+static inline VecD VMin(VecD a, VecD b) { return _mm256_min_pd(a, b); }
+static inline VecD VMax(VecD a, VecD b) { return _mm256_max_pd(a, b); }
+static inline VecD VAnd(VecD a, VecD b) { return _mm256_and_pd(a, b); }
+static inline VecD VAndNot(VecD a, VecD b) { return _mm256_andnot_pd(a, b); }
+static inline VecD VOr(VecD a, VecD b) { return _mm256_or_pd(a, b); }
+static inline VecD VLess(VecD a, VecD b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+static inline VecD VSelect(VecD mask, VecD a, VecD b) { return _mm256_blendv_pd(b, a, mask); }
+// 四舍五入取整，并构造2^n
+static inline VecD VRound(VecD x) { return _mm256_cvtepi32_pd(_mm256_cvtpd_epi32(x)); }
+static inline VecD VPow2(VecD n) {
+    __m256i e = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n));
+    e = _mm256_slli_epi64(_mm256_add_epi64(e, _mm256_set1_epi64x(1023)), 52);
+    return _mm256_castsi256_pd(e);
+}
+#elif defined(__SSE2__)
+// SSE2路径：每次处理2个double
+typedef __m128d VecD;
+static constexpr size_t VEC_WIDTH = 2;
+static inline VecD VLoad(const double* p) { return _mm_loadu_pd(p); }
+static inline void VStore(double* p, VecD v) { _mm_storeu_pd(p, v); }
+static inline VecD VSet(double x) { return _mm_set1_pd(x); }
+static inline VecD VAdd(VecD a, VecD b) { return _mm_add_pd(a, b); }
+static inline VecD VSub(VecD a, VecD b) { return _mm_sub_pd(a, b); }
+static inline VecD VMul(VecD a, VecD b) { return _mm_mul_pd(a, b); }
+static inline VecD VDiv(VecD a, VecD b) { return _mm_div_pd(a, b); }
+static inline VecD VMin(VecD a, VecD b) { return _mm_min_pd(a, b); }
+static inline VecD VMax(VecD a, VecD b) { return _mm_max_pd(a, b); }
+static inline VecD VAnd(VecD a, VecD b) { return _mm_and_pd(a, b); }
+static inline VecD VAndNot(VecD a, VecD b) { return _mm_andnot_pd(a, b); }
+static inline VecD VOr(VecD a, VecD b) { return _mm_or_pd(a, b); }
+static inline VecD VLess(VecD a, VecD b) { return _mm_cmplt_pd(a, b); }
+static inline VecD VSelect(VecD mask, VecD a, VecD b) {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+// 四舍五入取整，并构造2^n（n+1023恒为正，可零扩展为64位）
+static inline VecD VRound(VecD x) { return _mm_cvtepi32_pd(_mm_cvtpd_epi32(x)); }
+static inline VecD VPow2(VecD n) {
+    __m128i e = _mm_add_epi32(_mm_cvtpd_epi32(n), _mm_set1_epi32(1023));
+    e = _mm_slli_epi64(_mm_unpacklo_epi32(e, _mm_setzero_si128()), 52);
+    return _mm_castsi128_pd(e);
+}
+#endif
+
+#ifdef ANN_SIMD_ACTIVATION
+// 函数名：VExp
+// 功能：exp的向量近似，算法同ExpApprox
+// 入口参数：VecD x
+// 出口参数：无
+// 返回值：exp(x)近似值
+static inline VecD VExp(VecD x) {
+    x = VMin(VMax(x, VSet(EXP_LO)), VSet(EXP_HI));
+    VecD n = VRound(VMul(x, VSet(LOG2E)));
+    VecD r = VSub(VSub(x, VMul(n, VSet(LN2_HI))), VMul(n, VSet(LN2_LO)));
+    VecD rr = VMul(r, r);
+    VecD px = VMul(r, VAdd(VMul(VAdd(VMul(VSet(EXP_P0), rr), VSet(EXP_P1)), rr), VSet(EXP_P2)));
+    VecD qx = VAdd(VMul(VAdd(VMul(VAdd(VMul(VSet(EXP_Q0), rr), VSet(EXP_Q1)), rr),
+                             VSet(EXP_Q2)), rr), VSet(EXP_Q3));
+    VecD e = VAdd(VSet(1.0), VDiv(VMul(VSet(2.0), px), VSub(qx, px)));
+    return VMul(e, VPow2(n));
+}
+
+// 函数名：VTanh
+// 功能：tanh的向量近似，两个区间分别计算后按掩码选择，算法同TanhApprox
+// 入口参数：VecD x
+// 出口参数：无
+// 返回值：tanh(x)近似值
+static inline VecD VTanh(VecD x) {
+    const VecD sign = VSet(-0.0);
+    VecD a = VAndNot(sign, x);
+    VecD z = VMul(x, x);
+    VecD p = VAdd(VMul(VAdd(VMul(VSet(TANH_P0), z), VSet(TANH_P1)), z), VSet(TANH_P2));
+    VecD q = VAdd(VMul(VAdd(VMul(VAdd(z, VSet(TANH_Q0)), z), VSet(TANH_Q1)), z), VSet(TANH_Q2));
+    VecD small = VAdd(x, VDiv(VMul(VMul(x, z), p), q));
+    VecD e = VExp(VMul(VSet(2.0), a));
+    VecD large = VSub(VSet(1.0), VDiv(VSet(2.0), VAdd(e, VSet(1.0))));
+    large = VOr(large, VAnd(sign, x));
+    return VSelect(VLess(a, VSet(TANH_SMALL)), small, large);
+}
+
+// 函数名：VTanhRational
+// 功能：tanh有理近似的向量版本，算法同TanhRational
+// 入口参数：VecD x
+// 出口参数：无
+// 返回值：tanh(x)近似值
+static inline VecD VTanhRational(VecD x) {
+    // NaN时min/max返回第二个操作数，x放在第二位使NaN得以保留
+    const VecD c = VMin(VSet(TANH_CLAMP), VMax(VSet(-TANH_CLAMP), x));
+    const VecD z = VMul(c, c);
+    VecD p = VAdd(VMul(VSet(TANH_A13), z), VSet(TANH_A11));
+    p = VAdd(VMul(p, z), VSet(TANH_A9));
+    p = VAdd(VMul(p, z), VSet(TANH_A7));
+    p = VAdd(VMul(p, z), VSet(TANH_A5));
+    p = VAdd(VMul(p, z), VSet(TANH_A3));
+    p = VMul(VAdd(VMul(p, z), VSet(TANH_A1)), c);
+    VecD q = VAdd(VMul(VSet(TANH_B6), z), VSet(TANH_B4));
+    q = VAdd(VMul(q, z), VSet(TANH_B2));
+    q = VAdd(VMul(q, z), VSet(TANH_B0));
+    return VDiv(p, q);
+}
+#endif
 
 
 //------------------------------------------------------------------------------
 // 函数名：createAF
-// 功能：根据激活函数类型码创建对应的激活函数对象
+// 功能：根据激活函数类型码获取共享的激活函数对象。激活函数无状态，
+//       每种类型只在首次使用时创建一个对象，此后返回同一对象
 // 入口参数：激活函数的类型码
 // 出口参数：无
-// 返回值：指向 ActivationFunction 基类的指针
+// 返回值：指向 ActivationFunction 基类的指针，非法类型返回空指针
 std::shared_ptr<ActivationFunction> ActivationFunction::createAF(int type)
 {
-switch (type) {
+    // 按类型码排列的共享单例，局部静态变量保证线程安全的一次初始化
+    static const std::shared_ptr<ActivationFunction> INSTANCES[TYPE_COUNT] = {
         // 线性激活
-        case 0: 
-            return std::make_shared<LinearActivation>();
+        std::make_shared<LinearActivation>(),
         // Sigmoid激活
-        case 1:  
-            return std::make_shared<SigmoidActivation>();
+        std::make_shared<SigmoidActivation>(),
         // Tanh激活
-        case 2:  
-            return std::make_shared<TanhActivation>();
+        std::make_shared<TanhActivation>(),
         // ReLU激活
-        case 3:  
-            return std::make_shared<ReLUActivation>();
-        // 非法处理
-        default: 
-            return NULL; 
+        std::make_shared<ReLUActivation>()
+    };
+    // 非法处理
+    if (!IsValidType(type)) {
+        return nullptr;
+    }
+    return INSTANCES[type];
+}
+
+// 函数名：GetInstance
+// 功能：获取类型码对应的共享单例，不增加引用计数
+// 入口参数：激活函数的类型码
+// 出口参数：无
+// 返回值：单例指针，非法类型返回nullptr
+const ActivationFunction* ActivationFunction::GetInstance(int type) {
+    // 单例只创建一次，此后各类型的指针保持不变
+    static const ActivationFunction* const POINTERS[TYPE_COUNT] = {
+        createAF(LINEAR).get(), createAF(SIGMOID).get(),
+        createAF(TANH).get(), createAF(RELU).get()
+    };
+    return IsValidType(type) ? POINTERS[type] : nullptr;
+}
+
+// 函数名：GetInstance
+// 功能：获取类型码与近似方式对应的共享单例。Sigmoid、Tanh的快速近似对象
+//       只在首次使用时创建；其他类型或ACCURATE方式返回按类型码的单例
+// 入口参数：int type 激活函数的类型码, APPROXIMATION mode 近似方式
+// 出口参数：无
+// 返回值：单例指针，非法类型返回nullptr
+const ActivationFunction* ActivationFunction::GetInstance(int type, APPROXIMATION mode) {
+    static const SigmoidTableActivation SIGMOID_TABLE;
+    static const TanhTableActivation TANH_TABLE;
+    static const SigmoidRationalActivation SIGMOID_RATIONAL;
+    static const TanhRationalActivation TANH_RATIONAL;
+    if (mode == APPROXIMATION::TABLE) {
+        if (type == SIGMOID) {
+            return &SIGMOID_TABLE;
+        }
+        if (type == TANH) {
+            return &TANH_TABLE;
+        }
+    }
+    else if (mode == APPROXIMATION::RATIONAL) {
+        if (type == SIGMOID) {
+            return &SIGMOID_RATIONAL;
+        }
+        if (type == TANH) {
+            return &TANH_RATIONAL;
+        }
+    }
+    return GetInstance(type);
+}
+
+// 函数名：Apply
+// 功能：对连续数组批量计算激活值，默认逐元素调用operator()
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void ActivationFunction::Apply(const double* in, double* out, size_t n) const {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = (*this)(in[i]);
+    }
+}
+
+// 函数名：Apply
+// 功能：对float数组批量计算激活值。按块转换为double后复用double版本的
+//       （可能向量化的）Apply，保证float路径与double路径的激活函数一致
+// 入口参数：const float* in, size_t n
+// 出口参数：float* out
+// 返回值：无
+void ActivationFunction::Apply(const float* in, float* out, size_t n) const {
+    constexpr size_t CHUNK{256};
+    double buffer[CHUNK];
+    for (size_t start = 0; start < n; start += CHUNK) {
+        const size_t len = std::min(CHUNK, n - start);
+        for (size_t i = 0; i < len; ++i) {
+            buffer[i] = in[start + i];
+        }
+        Apply(buffer, buffer, len);
+        for (size_t i = 0; i < len; ++i) {
+            out[start + i] = static_cast<float>(buffer[i]);
+        }
     }
 }
 
@@ -57,6 +392,17 @@ double LinearActivation::operator()(double x) const {
     return x;
 }
 
+// 函数名：Apply
+// 功能：批量计算线性激活值，原地计算时无需任何操作
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void LinearActivation::Apply(const double* in, double* out, size_t n) const {
+    if (in != out) {
+        std::copy(in, in + n, out);
+    }
+}
+
 // Sigmoid激活函数的实现（类型码1）
 // 函数名：operator
 // 功能：计算Sigmoid激活值
@@ -68,6 +414,26 @@ double SigmoidActivation::operator()(double x) const {
     return 1.0 / (1.0 + std::exp(-x)); 
 }
 
+// 函数名：Apply
+// 功能：批量计算Sigmoid激活值，使用向量化exp近似
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void SigmoidActivation::Apply(const double* in, double* out, size_t n) const {
+    size_t i = 0;
+#ifdef ANN_SIMD_ACTIVATION
+    const VecD one = VSet(1.0);
+    const VecD zero = VSet(0.0);
+    for (; i + VEC_WIDTH <= n; i += VEC_WIDTH) {
+        VecD e = VExp(VSub(zero, VLoad(in + i)));
+        VStore(out + i, VDiv(one, VAdd(one, e)));
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = 1.0 / (1.0 + ExpApprox(-in[i]));
+    }
+}
+
 
 
 // Tanh激活函数的实现（类型码2）
@@ -81,6 +447,23 @@ double TanhActivation::operator()(double x) const {
     return std::tanh(x);  
 }
 
+// 函数名：Apply
+// 功能：批量计算Tanh激活值，使用向量化tanh近似
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void TanhActivation::Apply(const double* in, double* out, size_t n) const {
+    size_t i = 0;
+#ifdef ANN_SIMD_ACTIVATION
+    for (; i + VEC_WIDTH <= n; i += VEC_WIDTH) {
+        VStore(out + i, VTanh(VLoad(in + i)));
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = TanhApprox(in[i]);
+    }
+}
+
 
 // ReLU激活函数的实现（类型码3）
 // 函数名：operator
@@ -92,3 +475,122 @@ double ReLUActivation::operator()(double x) const {
     // ReLU变换：max(0, x)
     return (x > 0.0) ? x : 0.0;
 }
+
+// 函数名：Apply
+// 功能：批量计算ReLU激活值
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void ReLUActivation::Apply(const double* in, double* out, size_t n) const {
+    size_t i = 0;
+#ifdef ANN_SIMD_ACTIVATION
+    const VecD zero = VSet(0.0);
+    for (; i + VEC_WIDTH <= n; i += VEC_WIDTH) {
+        VStore(out + i, VMax(VLoad(in + i), zero));
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = (in[i] > 0.0) ? in[i] : 0.0;
+    }
+}
+
+
+// 查表近似的Tanh激活函数的实现（类型码2）
+// 函数名：operator
+// 功能：以查表线性插值计算Tanh激活值
+// 入口参数：输入值
+// 出口参数：无
+// 返回值：激活后的值
+double TanhTableActivation::operator()(double x) const {
+    return TanhLookup(TanhTable(), x);
+}
+
+// 函数名：Apply
+// 功能：批量计算查表近似的Tanh激活值
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void TanhTableActivation::Apply(const double* in, double* out, size_t n) const {
+    const double* table = TanhTable();
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = TanhLookup(table, in[i]);
+    }
+}
+
+// 查表近似的Sigmoid激活函数的实现（类型码1）
+// 函数名：operator
+// 功能：以查表近似计算Sigmoid激活值：(1 + tanh(x/2)) / 2
+// 入口参数：输入值
+// 出口参数：无
+// 返回值：激活后的值
+double SigmoidTableActivation::operator()(double x) const {
+    return 0.5 + 0.5 * TanhLookup(TanhTable(), 0.5 * x);
+}
+
+// 函数名：Apply
+// 功能：批量计算查表近似的Sigmoid激活值
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void SigmoidTableActivation::Apply(const double* in, double* out, size_t n) const {
+    const double* table = TanhTable();
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = 0.5 + 0.5 * TanhLookup(table, 0.5 * in[i]);
+    }
+}
+
+// 有理近似的Tanh激活函数的实现（类型码2）
+// 函数名：operator
+// 功能：以有理近似计算Tanh激活值
+// 入口参数：输入值
+// 出口参数：无
+// 返回值：激活后的值
+double TanhRationalActivation::operator()(double x) const {
+    return TanhRational(x);
+}
+
+// 函数名：Apply
+// 功能：批量计算有理近似的Tanh激活值，使用向量化有理近似
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void TanhRationalActivation::Apply(const double* in, double* out, size_t n) const {
+    size_t i = 0;
+#ifdef ANN_SIMD_ACTIVATION
+    for (; i + VEC_WIDTH <= n; i += VEC_WIDTH) {
+        VStore(out + i, VTanhRational(VLoad(in + i)));
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = TanhRational(in[i]);
+    }
+}
+
+// 有理近似的Sigmoid激活函数的实现（类型码1）
+// 函数名：operator
+// 功能：以有理近似计算Sigmoid激活值：(1 + tanh(x/2)) / 2
+// 入口参数：输入值
+// 出口参数：无
+// 返回值：激活后的值
+double SigmoidRationalActivation::operator()(double x) const {
+    return 0.5 + 0.5 * TanhRational(0.5 * x);
+}
+
+// 函数名：Apply
+// 功能：批量计算有理近似的Sigmoid激活值，使用向量化有理近似
+// 入口参数：const double* in, size_t n
+// 出口参数：double* out
+// 返回值：无
+void SigmoidRationalActivation::Apply(const double* in, double* out, size_t n) const {
+    size_t i = 0;
+#ifdef ANN_SIMD_ACTIVATION
+    const VecD half = VSet(0.5);
+    for (; i + VEC_WIDTH <= n; i += VEC_WIDTH) {
+        VecD t = VTanhRational(VMul(half, VLoad(in + i)));
+        VStore(out + i, VAdd(half, VMul(half, t)));
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = 0.5 + 0.5 * TanhRational(0.5 * in[i]);
+    }
+}
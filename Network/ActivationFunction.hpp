@@ -16,6 +16,10 @@
 
 //std::shared_ptr所属头文件 
 #include <memory>      
+//size_t所属头文件
+#include <cstddef>
+//std::exp、std::tanh所属头文件
+#include <cmath>
 
 //------------------------------------------------------------------------------
 //【类名】ActivationFunction
@@ -26,7 +30,13 @@
 //    SigmoidActivation：实现Sigmoid激活函数
 //    TanhActivation：实现Tanh激活函数
 //    ReLUActivation：实现ReLU激活函数
+//    Apply：对连续数组批量计算激活值，x86下使用AVX2/SSE2向量路径
 //【开发者及日期】Lychee 2025/7/13
+//【更改记录】2026/10/17 增加数组级Apply接口及向量化exp/tanh近似
+//            2026/10/17 增加float数组版本Apply
+//            2026/10/17 激活函数对象改为按类型码共享的无状态单例，
+//                       增加以类型码switch分派的内联Evaluate
+//            2026/10/18 增加Sigmoid、Tanh的查表与有理近似模式
 //------------------------------------------------------------------------------
 
 
@@ -41,10 +51,44 @@ public:
     void operator=(const ActivationFunction&) = delete;
     // 虚析构函数，默认实现
     virtual ~ActivationFunction() = default;
-    // 根据类型码创建对应的激活函数对象，静态函数
+    // 激活类型码
+    static constexpr int LINEAR{0};
+    static constexpr int SIGMOID{1};
+    static constexpr int TANH{2};
+    static constexpr int RELU{3};
+    // 类型码数量
+    static constexpr int TYPE_COUNT{4};
+    // Sigmoid、Tanh的近似方式（其他类型不受影响）
+    enum class APPROXIMATION : int {
+        // 向量化exp/tanh近似，绝对误差不超过1e-15（默认）
+        ACCURATE = 0,
+        // 查表线性插值，绝对误差Tanh不超过TABLE_ERROR，Sigmoid不超过其一半
+        TABLE = 1,
+        // 极小化极大有理近似，绝对误差Tanh不超过RATIONAL_ERROR，Sigmoid不超过其一半
+        RATIONAL = 2
+    };
+    // 查表近似的绝对误差上界（全体double输入，NaN除外）
+    static constexpr double TABLE_ERROR{1.5e-6};
+    // 有理近似的绝对误差上界（全体double输入，NaN除外）
+    static constexpr double RATIONAL_ERROR{3e-7};
+    // 判断类型码是否合法，静态函数
+    static constexpr bool IsValidType(int type);
+    // 获取类型码对应的共享单例（无状态，全局唯一），非法类型返回nullptr，静态函数
+    static const ActivationFunction* GetInstance(int type);
+    // 获取类型码与近似方式对应的共享单例，Sigmoid、Tanh以外的类型忽略近似方式，静态函数
+    static const ActivationFunction* GetInstance(int type, APPROXIMATION mode);
+    // 根据类型码获取共享的激活函数对象（不再逐个分配），非法类型返回空指针，静态函数
     static std::shared_ptr<ActivationFunction> createAF(int type);
+    // 以类型码计算激活值：switch分派并内联于调用处，无虚函数调用，
+    // 结果与对应派生类的operator()完全一致，静态函数
+    static double Evaluate(int type, double x);
     // 计算激活函数值，子类实现，纯虚函数，运算符()重载
     virtual double operator()(double x) const = 0;
+    // 对连续数组批量计算激活值，允许in与out相同（原地计算）
+    // 默认逐元素调用operator()，派生类可提供向量化实现
+    virtual void Apply(const double* in, double* out, size_t n) const;
+    // float数组版本，分块转换为double后调用上面的Apply，结果舍入为float
+    void Apply(const float* in, float* out, size_t n) const;
 };
 //------------------------------------------------------------------------------
 
@@ -54,25 +98,101 @@ public:
 class LinearActivation final : public ActivationFunction {
 public:
     double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
 };
 
 // Sigmoid激活函数的声明（类型码1）
+// Apply使用向量化exp近似，与operator()的绝对误差不超过1e-15
 class SigmoidActivation final : public ActivationFunction {
 public:
     double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
 };
 
 // Tanh激活函数的声明（类型码2）
+// Apply使用向量化tanh近似，与operator()的绝对误差不超过1e-15
 class TanhActivation final : public ActivationFunction {
 public:
     double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
 };
 
 // ReLU激活函数的声明（类型码3）
 class ReLUActivation final : public ActivationFunction {
 public:
     double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
 };
+
+// 查表近似的Tanh激活函数的声明（类型码2，APPROXIMATION::TABLE）
+// 按奇对称约化到|x|，在[0, 8]上以1/256为步长的表中线性插值，更大的|x|取±1。
+// 插值误差不超过h²/8·max|tanh''| ≈ 1.47e-6，截断误差1-tanh(8) ≈ 2.3e-7
+class TanhTableActivation final : public ActivationFunction {
+public:
+    double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
+};
+
+// 查表近似的Sigmoid激活函数的声明（类型码1，APPROXIMATION::TABLE）
+// 由sigmoid(x) = (1 + tanh(x/2)) / 2得到，误差为Tanh查表的一半
+class SigmoidTableActivation final : public ActivationFunction {
+public:
+    double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
+};
+
+// 有理近似的Tanh激活函数的声明（类型码2，APPROXIMATION::RATIONAL）
+// 输入截断到±7.905后以13/6阶奇有理函数（极小化极大拟合系数）计算，
+// 截断区间内误差约2.6e-8，区间外误差不超过1-tanh(7.905) ≈ 2.7e-7
+class TanhRationalActivation final : public ActivationFunction {
+public:
+    double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
+};
+
+// 有理近似的Sigmoid激活函数的声明（类型码1，APPROXIMATION::RATIONAL）
+// 由sigmoid(x) = (1 + tanh(x/2)) / 2得到，误差为Tanh有理近似的一半
+class SigmoidRationalActivation final : public ActivationFunction {
+public:
+    double operator()(double x) const override;
+    void Apply(const double* in, double* out, size_t n) const override;
+};
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// 内联静态成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：IsValidType
+// 功能：判断类型码是否合法
+// 入口参数：int type
+// 出口参数：无
+// 返回值：合法返回true
+constexpr bool ActivationFunction::IsValidType(int type) {
+    return type >= LINEAR && type < TYPE_COUNT;
+}
+
+// 函数名：Evaluate
+// 功能：以类型码计算激活值，非法类型按线性处理（类型码在设置时已检查）
+// 入口参数：int type, double x
+// 出口参数：无
+// 返回值：激活后的值
+inline double ActivationFunction::Evaluate(int type, double x) {
+    switch (type) {
+        // Sigmoid激活
+        case SIGMOID:
+            return 1.0 / (1.0 + std::exp(-x));
+        // Tanh激活
+        case TANH:
+            return std::tanh(x);
+        // ReLU激活
+        case RELU:
+            return (x > 0.0) ? x : 0.0;
+        // 线性激活
+        default:
+            return x;
+    }
+}
 //------------------------------------------------------------------------------
 
 #endif /* ActivationFunction_hpp */
@@ -0,0 +1,855 @@
+//
+//  CompiledNetwork.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】CompiledNetwork.cpp
+//【功能模块和目的】编译后的扁平推理计划类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】2026/10/17 增加float32执行模式及输出偏差对比
+//            2026/10/17 增加int8训练后量化模式
+//            2026/10/17 增加线程池并行批量推理
+//            2026/10/17 增加可重入推理上下文
+//            2026/10/17 按连接密度选择稠密或CSR稀疏执行
+//            2026/10/17 使用共享的激活函数单例
+//            2026/10/17 增加按阶段区间分段执行的接口
+//            2026/10/18 编译时可选Sigmoid、Tanh的快速近似方式
+//            2026/10/18 可只编译指定输出的反向锥
+//            2026/10/18 ReLU源稀疏时自动切换为跳过零值的散射形式
+//            2026/10/18 收集、分层与编号改由NetworkGraph完成
+//            2026/10/18 散射形式按本次源值稀疏度选择，推理不再写入共享统计
+//------------------------------------------------------------------------------
+
+// CompiledNetwork类所属头文件
+#include "CompiledNetwork.hpp"
+// Network类所属头文件
+#include "Network.hpp"
+// NetworkGraph类所属头文件
+#include "NetworkGraph.hpp"
+// 异常基类所属头文件
+#include <stdexcept>
+// DenseKernel类所属头文件
+#include "DenseKernel.hpp"
+// Int8Kernel类所属头文件
+#include "Int8Kernel.hpp"
+// SparseKernel类所属头文件
+#include "SparseKernel.hpp"
+// ThreadPool类所属头文件
+#include "ThreadPool.hpp"
+// std::min_element、std::max_element所属头文件
+#include <algorithm>
+// std::fabs所属头文件
+#include <cmath>
+// std::is_same_v所属头文件
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：CompiledNetwork
+// 功能：由网络编译生成推理计划。神经元按拓扑层级排序，
+//       同一层级内输入神经元在前，其余按层列表顺序排列；
+//       FLOAT模式下偏置与权重在此一次性转换为float
+// 入口参数：const Network& ANetwork, PRECISION Precision 计算精度,
+//           ActivationFunction::APPROXIMATION Approximation Sigmoid、Tanh的近似方式
+// 出口参数：无
+// 返回值：无
+CompiledNetwork::CompiledNetwork(const Network& ANetwork, PRECISION Precision,
+                                 ActivationFunction::APPROXIMATION Approximation)
+    : m_Precision(Precision), m_Approximation(Approximation) {
+    if (m_Precision == PRECISION::INT8) {
+        throw std::invalid_argument("INT8 precision requires calibration samples");
+    }
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Network is not valid for compilation");
+    }
+    Build(ANetwork, nullptr);
+}
+
+// 函数名：CompiledNetwork
+// 功能：只编译指定输出的反向锥：从这些输出神经元沿树突反向可达的神经元
+//       与全部输入神经元，其余神经元不参与计算。输出按OutputIndices的顺序排列，
+//       输入数量与完整网络相同
+// 入口参数：const Network& ANetwork, const std::vector<size_t>& OutputIndices 输出序号,
+//           ActivationFunction::APPROXIMATION Approximation Sigmoid、Tanh的近似方式
+// 出口参数：无
+// 返回值：无，网络不合理时抛出std::runtime_error，序号越界时抛出std::out_of_range
+CompiledNetwork::CompiledNetwork(const Network& ANetwork, const std::vector<size_t>& OutputIndices,
+                                 ActivationFunction::APPROXIMATION Approximation)
+    : m_Precision(PRECISION::DOUBLE), m_Approximation(Approximation) {
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Network is not valid for compilation");
+    }
+    const size_t outputCount = ANetwork.GetOutputMarker().size();
+    for (size_t index : OutputIndices) {
+        if (index >= outputCount) {
+            throw std::out_of_range("Output index out of range");
+        }
+    }
+    Build(ANetwork, &OutputIndices);
+}
+
+// 函数名：CompiledNetwork
+// 功能：由网络编译生成INT8量化计划：先按double编译，再以校准样本量化稠密阶段
+// 入口参数：const Network& ANetwork
+//           const std::vector<double>& calibration 行主序校准样本矩阵
+//           QUANTIZATION Granularity 权重缩放因子粒度
+// 出口参数：无
+// 返回值：无
+CompiledNetwork::CompiledNetwork(const Network& ANetwork,
+                                 const std::vector<double>& calibration,
+                                 QUANTIZATION Granularity)
+    : CompiledNetwork(ANetwork, PRECISION::DOUBLE) {
+    Quantize(calibration, Granularity);
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Inference
+// 功能：按拓扑顺序对连续数组执行前向传播，内部按计划精度计算
+// 入口参数：输入值列表
+// 出口参数：无
+// 返回值：输出值列表，输入数量不匹配时返回空列表
+std::vector<double> CompiledNetwork::Inference(const std::vector<double>& input) const {
+    if (input.size() != m_InputIndex.size()) {
+        return {};
+    }
+    std::vector<double> outputs(m_OutputIndex.size());
+    InferenceBatch(input.data(), 1, outputs.data());
+    return outputs;
+}
+
+// 函数名：Inference
+// 功能：使用调用者持有的上下文执行前向传播。全部中间结果写入context，
+//       不修改计划与网络中的任何状态，不同上下文可在多个线程中并发使用
+// 入口参数：const std::vector<double>& input 输入值列表
+// 出口参数：InferenceContext& context 推理上下文
+// 返回值：context.Outputs的引用，输入数量不匹配时为空列表
+const std::vector<double>& CompiledNetwork::Inference(const std::vector<double>& input,
+                                                      InferenceContext& context) const {
+    if (input.size() != m_InputIndex.size()) {
+        context.Outputs.clear();
+        return context.Outputs;
+    }
+    context.Outputs.resize(m_OutputIndex.size());
+    if (m_Precision == PRECISION::FLOAT) {
+        context.ScatterStages =
+            RunBatch<float>(input.data(), 1, context.Outputs.data(), context.FloatValues);
+    } else {
+        context.ScatterStages =
+            RunBatch<double>(input.data(), 1, context.Outputs.data(), context.Values);
+    }
+    return context.Outputs;
+}
+
+// 函数名：InferenceBatch
+// 功能：对一批样本执行前向传播（double输入输出），内部按计划精度计算
+// 入口参数：const double* in 行主序输入矩阵（batch行，每行GetInputCount()个值）
+//           size_t batch 样本数
+// 出口参数：double* out 行主序输出矩阵（batch行，每行GetOutputCount()个值）
+// 返回值：无
+void CompiledNetwork::InferenceBatch(const double* in, size_t batch, double* out) const {
+    Execute(in, batch, out);
+}
+
+// 函数名：InferenceBatch
+// 功能：对一批样本执行前向传播（float输入输出），内部按计划精度计算
+// 入口参数：const float* in 行主序输入矩阵（batch行，每行GetInputCount()个值）
+//           size_t batch 样本数
+// 出口参数：float* out 行主序输出矩阵（batch行，每行GetOutputCount()个值）
+// 返回值：无
+void CompiledNetwork::InferenceBatch(const float* in, size_t batch, float* out) const {
+    Execute(in, batch, out);
+}
+
+// 函数名：CompareWith
+// 功能：以同一批样本分别运行本计划与参考计划，逐个输出值统计绝对偏差，
+//       用于评估FLOAT等低精度模式相对DOUBLE计划的精度损失
+// 入口参数：const CompiledNetwork& Reference 参考计划
+//           const std::vector<double>& samples 行主序样本矩阵
+// 出口参数：无
+// 返回值：DeviationReport 偏差报告
+CompiledNetwork::DeviationReport CompiledNetwork::CompareWith(
+    const CompiledNetwork& Reference, const std::vector<double>& samples) const {
+    const size_t inputCount = GetInputCount();
+    if (inputCount != Reference.GetInputCount() ||
+        GetOutputCount() != Reference.GetOutputCount() ||
+        inputCount == 0 || samples.size() % inputCount != 0) {
+        throw std::invalid_argument("Sample matrix does not match the plan inputs");
+    }
+    DeviationReport report;
+    report.Samples = samples.size() / inputCount;
+    const size_t values = report.Samples * GetOutputCount();
+    std::vector<double> actual(values);
+    std::vector<double> expected(values);
+    InferenceBatch(samples.data(), report.Samples, actual.data());
+    Reference.InferenceBatch(samples.data(), report.Samples, expected.data());
+    double sum{0.0};
+    for (size_t i = 0; i < values; ++i) {
+        const double deviation = std::fabs(actual[i] - expected[i]);
+        report.MaxAbs = std::max(report.MaxAbs, deviation);
+        sum += deviation;
+    }
+    if (values > 0) {
+        report.MeanAbs = sum / static_cast<double>(values);
+    }
+    return report;
+}
+
+// 函数名：CompareWith
+// 功能：以同一批样本分别运行本计划与对象图上的Network::Inference，
+//       逐个输出值统计绝对偏差，用于评估量化等近似计划的精度
+// 入口参数：const std::vector<double>& samples 行主序样本矩阵
+// 出口参数：Network& ANetwork 参考网络（推理会更新其神经元输出）
+// 返回值：DeviationReport 偏差报告
+CompiledNetwork::DeviationReport CompiledNetwork::CompareWith(
+    Network& ANetwork, const std::vector<double>& samples) const {
+    const size_t inputCount = GetInputCount();
+    if (inputCount != ANetwork.GetInputMarker().size() ||
+        GetOutputCount() != ANetwork.GetOutputMarker().size() ||
+        inputCount == 0 || samples.size() % inputCount != 0) {
+        throw std::invalid_argument("Sample matrix does not match the plan inputs");
+    }
+    DeviationReport report;
+    report.Samples = samples.size() / inputCount;
+    double sum{0.0};
+    for (size_t s = 0; s < report.Samples; ++s) {
+        std::vector<double> input(samples.begin() + s * inputCount,
+                                  samples.begin() + (s + 1) * inputCount);
+        std::vector<double> actual = Inference(input);
+        std::vector<double> expected = ANetwork.Inference(input);
+        for (size_t o = 0; o < actual.size(); ++o) {
+            const double deviation = std::fabs(actual[o] - expected[o]);
+            report.MaxAbs = std::max(report.MaxAbs, deviation);
+            sum += deviation;
+        }
+    }
+    if (report.Samples > 0 && GetOutputCount() > 0) {
+        report.MeanAbs = sum / static_cast<double>(report.Samples * GetOutputCount());
+    }
+    return report;
+}
+
+// 函数名：GetThreadCount
+// 功能：获取批量推理线程数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 线程数（含调用线程）
+size_t CompiledNetwork::GetThreadCount() const {
+    return m_pPool ? m_pPool->GetThreadCount() : 1;
+}
+
+// 函数名：GetPrecision
+// 功能：获取计划内部的计算精度
+// 入口参数：无
+// 出口参数：无
+// 返回值：PRECISION 计算精度
+CompiledNetwork::PRECISION CompiledNetwork::GetPrecision() const {
+    return m_Precision;
+}
+
+// 函数名：GetApproximation
+// 功能：获取Sigmoid、Tanh激活的近似方式
+// 入口参数：无
+// 出口参数：无
+// 返回值：ActivationFunction::APPROXIMATION 近似方式
+ActivationFunction::APPROXIMATION CompiledNetwork::GetApproximation() const {
+    return m_Approximation;
+}
+
+// 函数名：GetStageCount
+// 功能：获取计算阶段数量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 阶段数量
+size_t CompiledNetwork::GetStageCount() const {
+    return m_Stages.size();
+}
+
+// 函数名：GetStageCost
+// 功能：估算一个阶段对单个样本的乘加次数，用于划分流水线
+// 入口参数：size_t StageIndex 阶段索引
+// 出口参数：无
+// 返回值：size_t 稠密阶段为行数×源区间长度，稀疏阶段为突触数，另加神经元数；
+//         索引越界时抛出std::out_of_range
+size_t CompiledNetwork::GetStageCost(size_t StageIndex) const {
+    const Stage& stage = m_Stages.at(StageIndex);
+    const size_t rows = stage.End - stage.Begin;
+    if (stage.Dense) {
+        return rows * (stage.SourceEnd - stage.SourceBegin) + rows;
+    }
+    return m_RowStart[stage.End] - m_RowStart[stage.Begin] + rows;
+}
+
+// 函数名：LoadInputs
+// 功能：分段执行的第一步，输入神经元输出值为输入值加偏置
+// 入口参数：const double* in 行主序输入矩阵, size_t tile 样本数（不超过stride）,
+//          size_t stride 神经元×样本矩阵的行长度
+// 出口参数：double* values 神经元×样本矩阵
+// 返回值：无，FLOAT精度的计划抛出std::runtime_error
+void CompiledNetwork::LoadInputs(const double* in, size_t tile,
+                                 double* values, size_t stride) const {
+    if (m_Precision == PRECISION::FLOAT) {
+        throw std::runtime_error("Staged execution requires a double or int8 plan");
+    }
+    const size_t inputCount = m_InputIndex.size();
+    for (size_t i = 0; i < inputCount; ++i) {
+        const size_t idx = m_InputIndex[i];
+        double* row = values + idx * stride;
+        for (size_t b = 0; b < tile; ++b) {
+            row[b] = in[b * inputCount + i] + m_Double.Bias[idx];
+        }
+    }
+}
+
+// 函数名：ForwardStages
+// 功能：分段执行的中间步骤，按顺序计算阶段[Begin, End)
+// 入口参数：size_t Begin, size_t End 阶段区间, size_t stride 行长度, size_t tile 样本数
+// 出口参数：double* values 神经元×样本矩阵
+// 返回值：无
+void CompiledNetwork::ForwardStages(size_t Begin, size_t End, double* values,
+                                    size_t stride, size_t tile) const {
+    End = std::min(End, m_Stages.size());
+    for (size_t s = Begin; s < End; ++s) {
+        ForwardStage(m_Stages[s], values, stride, tile);
+    }
+}
+
+// 函数名：StoreOutputs
+// 功能：分段执行的最后一步，收集输出神经元的值
+// 入口参数：const double* values 神经元×样本矩阵, size_t stride 行长度, size_t tile 样本数
+// 出口参数：double* out 行主序输出矩阵
+// 返回值：无
+void CompiledNetwork::StoreOutputs(const double* values, size_t stride,
+                                   size_t tile, double* out) const {
+    const size_t outputCount = m_OutputIndex.size();
+    for (size_t o = 0; o < outputCount; ++o) {
+        const double* row = values + m_OutputIndex[o] * stride;
+        for (size_t b = 0; b < tile; ++b) {
+            out[b * outputCount + o] = row[b];
+        }
+    }
+}
+
+// 函数名：GetDenseStageCount
+// 功能：获取按稠密矩阵内核执行的阶段数量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 稠密阶段数量
+size_t CompiledNetwork::GetDenseStageCount() const {
+    return static_cast<size_t>(std::count_if(m_Stages.begin(), m_Stages.end(),
+        [](const Stage& stage) { return stage.Dense; }));
+}
+
+// 函数名：GetNeuronCount
+// 功能：获取神经元数量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 神经元数量
+size_t CompiledNetwork::GetNeuronCount() const {
+    return m_Activation.size();
+}
+
+// 函数名：GetSynapseCount
+// 功能：获取突触数量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 突触数量
+size_t CompiledNetwork::GetSynapseCount() const {
+    return m_Source.size();
+}
+
+// 函数名：GetInputCount
+// 功能：获取输入数量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 输入数量
+size_t CompiledNetwork::GetInputCount() const {
+    return m_InputIndex.size();
+}
+
+// 函数名：GetOutputCount
+// 功能：获取输出数量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 输出数量
+size_t CompiledNetwork::GetOutputCount() const {
+    return m_OutputIndex.size();
+}
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：SetThreadCount
+// 功能：设置批量推理线程数，重建线程池；0视为1，1时不创建线程池
+// 入口参数：size_t ThreadCount 线程数（含调用线程）
+// 出口参数：无
+// 返回值：无
+void CompiledNetwork::SetThreadCount(size_t ThreadCount) {
+    if (ThreadCount == GetThreadCount()) {
+        return;
+    }
+    m_pPool = ThreadCount > 1 ? std::make_shared<ThreadPool>(ThreadCount) : nullptr;
+}
+
+// 函数名：SetThreadPool
+// 功能：使用外部线程池执行批量推理
+// 入口参数：const std::shared_ptr<ThreadPool>& pPool 线程池，为空时单线程
+// 出口参数：无
+// 返回值：无
+void CompiledNetwork::SetThreadPool(const std::shared_ptr<ThreadPool>& pPool) {
+    m_pPool = pPool;
+}
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Build
+// 功能：编译推理计划。由NetworkGraph收集神经元并按层级编号（OutputIndices为空指针时
+//       为整个网络，否则为指定输出的反向锥与全部输入神经元），再按层级划分计算阶段
+// 入口参数：const Network& ANetwork, const std::vector<size_t>* OutputIndices 输出序号或nullptr
+// 出口参数：无
+// 返回值：无
+void CompiledNetwork::Build(const Network& ANetwork, const std::vector<size_t>* OutputIndices) {
+    // 1. 收集、分层、编号并复制为连续数组
+    const NetworkGraph graph(ANetwork, OutputIndices);
+    const size_t count = graph.GetNeuronCount();
+    const std::vector<size_t>& level = graph.GetLevel();
+    m_InputCount = graph.GetInputCount();
+    m_Double.Bias = graph.GetBias();
+    m_Double.Weight = graph.GetWeight();
+    m_Activation = graph.GetActivation();
+    m_RowStart = graph.GetRowStart();
+    m_Source = graph.GetSource();
+    m_InputIndex = graph.GetInputIndex();
+    m_OutputIndex = graph.GetOutputIndex();
+    if (m_Precision == PRECISION::FLOAT) {
+        m_Float.Bias.assign(m_Double.Bias.begin(), m_Double.Bias.end());
+        m_Float.Weight.assign(m_Double.Weight.begin(), m_Double.Weight.end());
+    }
+
+    // 2. 按层级划分计算阶段。以阶段内突触数与"行数×源区间长度"之比度量连接密度，
+    //    密度不低于DENSE_DENSITY的阶段展开为稠密矩阵（缺失连接补零），其余按CSR稀疏执行
+    for (size_t begin = m_InputCount; begin < count; ) {
+        size_t end = begin + 1;
+        while (end < count && level[end] == level[begin]) {
+            ++end;
+        }
+        Stage stage;
+        stage.Begin = begin;
+        stage.End = end;
+        const size_t first = m_RowStart[begin];
+        const size_t last = m_RowStart[end];
+        if (last > first) {
+            stage.SourceBegin = *std::min_element(m_Source.begin() + first, m_Source.begin() + last);
+            stage.SourceEnd = *std::max_element(m_Source.begin() + first, m_Source.begin() + last) + 1;
+            const double cells = static_cast<double>((end - begin) * (stage.SourceEnd - stage.SourceBegin));
+            stage.Dense = static_cast<double>(last - first) / cells >= DENSE_DENSITY;
+        }
+        std::vector<double> matrix;
+        if (stage.Dense) {
+            const size_t rows = end - begin;
+            const size_t cols = stage.SourceEnd - stage.SourceBegin;
+            matrix = StageMatrix(stage);
+            if (m_Precision == PRECISION::FLOAT) {
+                std::vector<float> packed;
+                DenseKernel<float>::Pack(matrix, rows, cols, packed);
+                stage.WeightOffset = m_Float.DenseWeight.size();
+                m_Float.DenseWeight.insert(m_Float.DenseWeight.end(), packed.begin(), packed.end());
+            } else {
+                std::vector<double> packed;
+                DenseKernel<double>::Pack(matrix, rows, cols, packed);
+                stage.WeightOffset = m_Double.DenseWeight.size();
+                m_Double.DenseWeight.insert(m_Double.DenseWeight.end(), packed.begin(), packed.end());
+            }
+        }
+        // 3. 源区间含ReLU神经元的阶段另存按源列排列的权重，实测稀疏度足够高时散射执行
+        for (size_t j = stage.SourceBegin; j < stage.SourceEnd && !stage.Scatter; ++j) {
+            stage.Scatter = m_Activation[j] == ActivationFunction::RELU;
+        }
+        if (stage.Scatter) {
+            BuildScatter(stage, matrix);
+        }
+        m_Stages.push_back(stage);
+        begin = end;
+    }
+}
+
+// 函数名：BuildScatter
+// 功能：生成阶段的散射形式权重。稠密阶段把行主序矩阵转为列主序，每列行数个权重；
+//       稀疏阶段把CSR突触转置为CSC，每列记录目标神经元（相对Begin）与权重。
+//       FLOAT模式同时生成float权重，两种精度的起始位置相同
+// 入口参数：Stage& stage, const std::vector<double>& matrix 稠密阶段的行主序矩阵
+// 出口参数：Stage& stage 记录散射形式数据的起始位置
+// 返回值：无
+void CompiledNetwork::BuildScatter(Stage& stage, const std::vector<double>& matrix) {
+    const size_t rows = stage.End - stage.Begin;
+    const size_t cols = stage.SourceEnd - stage.SourceBegin;
+    stage.ScatterOffset = m_ScatterStart.size();
+    stage.ScatterWeightOffset = m_Double.ScatterWeight.size();
+    stage.ScatterTargetOffset = m_ScatterTarget.size();
+    std::vector<double> weight;
+    if (stage.Dense) {
+        weight.resize(rows * cols);
+        for (size_t c = 0; c < cols; ++c) {
+            m_ScatterStart.push_back(c * rows);
+            for (size_t r = 0; r < rows; ++r) {
+                weight[c * rows + r] = matrix[r * cols + c];
+            }
+        }
+        m_ScatterStart.push_back(cols * rows);
+    }
+    else {
+        // 先统计各源列的突触数，再按列填入目标与权重
+        std::vector<size_t> start(cols + 1, 0);
+        for (size_t k = m_RowStart[stage.Begin]; k < m_RowStart[stage.End]; ++k) {
+            ++start[m_Source[k] - stage.SourceBegin + 1];
+        }
+        for (size_t c = 0; c < cols; ++c) {
+            start[c + 1] += start[c];
+        }
+        weight.resize(start[cols]);
+        std::vector<uint32_t> target(start[cols]);
+        std::vector<size_t> next(start.begin(), start.end() - 1);
+        for (size_t i = stage.Begin; i < stage.End; ++i) {
+            for (size_t k = m_RowStart[i]; k < m_RowStart[i + 1]; ++k) {
+                const size_t position = next[m_Source[k] - stage.SourceBegin]++;
+                target[position] = static_cast<uint32_t>(i - stage.Begin);
+                weight[position] = m_Double.Weight[k];
+            }
+        }
+        m_ScatterStart.insert(m_ScatterStart.end(), start.begin(), start.end());
+        m_ScatterTarget.insert(m_ScatterTarget.end(), target.begin(), target.end());
+    }
+    m_Double.ScatterWeight.insert(m_Double.ScatterWeight.end(), weight.begin(), weight.end());
+    if (m_Precision == PRECISION::FLOAT) {
+        m_Float.ScatterWeight.insert(m_Float.ScatterWeight.end(), weight.begin(), weight.end());
+    }
+}
+
+// 函数名：ForwardScatter
+// 功能：按散射形式计算一个阶段的加权和：逐个样本把非零源压缩为索引列表，
+//       只累加这些源的出边
+// 入口参数：const Stage& stage, size_t stride 行长度, size_t tile 有效样本数
+// 出口参数：T* values 神经元×样本矩阵，阶段内神经元累加加权和
+// 返回值：size_t 非零源值数（全部样本合计）
+template<class T>
+size_t CompiledNetwork::ForwardScatter(const Stage& stage, T* values,
+                                       size_t stride, size_t tile) const {
+    const Parameters<T>& params = GetParameters<T>();
+    const T* weight = params.ScatterWeight.data() + stage.ScatterWeightOffset;
+    const uint32_t* target = stage.Dense ? nullptr : m_ScatterTarget.data() + stage.ScatterTargetOffset;
+    const size_t* colStart = &m_ScatterStart[stage.ScatterOffset];
+    const size_t cols = stage.SourceEnd - stage.SourceBegin;
+    size_t active = 0;
+    for (size_t b = 0; b < tile; ++b) {
+        active += SparseKernel::Scatter(weight, target, colStart, cols,
+                                        values + stage.SourceBegin * stride + b, stride,
+                                        values + stage.Begin * stride + b);
+    }
+    return active;
+}
+
+// 函数名：Quantize
+// 功能：训练后量化。先以double计划运行校准样本，记录各神经元输出的最大绝对值，
+//       据此确定每个稠密阶段输入的缩放因子；再将稠密阶段权重按层或按神经元
+//       对称量化为[-127, 127]的int8，最后释放double打包权重并切换为INT8精度
+// 入口参数：const std::vector<double>& calibration 行主序校准样本矩阵
+//           QUANTIZATION Granularity 权重缩放因子粒度
+// 出口参数：无
+// 返回值：无
+void CompiledNetwork::Quantize(const std::vector<double>& calibration,
+                               QUANTIZATION Granularity) {
+    const size_t inputCount = m_InputIndex.size();
+    const size_t neuronCount = m_Activation.size();
+    if (inputCount == 0 || calibration.empty() || calibration.size() % inputCount != 0) {
+        throw std::invalid_argument("Calibration samples do not match the network inputs");
+    }
+    // 1. 以double计划运行校准样本，统计各神经元输出的最大绝对值
+    const size_t batch = calibration.size() / inputCount;
+    const size_t stride = std::min(batch, BATCH_TILE);
+    std::vector<double> values(neuronCount * stride);
+    std::vector<double> range(neuronCount, 0.0);
+    for (size_t start = 0; start < batch; start += stride) {
+        const size_t tile = std::min(stride, batch - start);
+        for (size_t i = 0; i < inputCount; ++i) {
+            const size_t idx = m_InputIndex[i];
+            for (size_t b = 0; b < tile; ++b) {
+                values[idx * stride + b] =
+                    calibration[(start + b) * inputCount + i] + m_Double.Bias[idx];
+            }
+        }
+        for (const auto& stage : m_Stages) {
+            ForwardStage(stage, values.data(), stride, tile);
+        }
+        for (size_t n = 0; n < neuronCount; ++n) {
+            for (size_t b = 0; b < tile; ++b) {
+                range[n] = std::max(range[n], std::fabs(values[n * stride + b]));
+            }
+        }
+    }
+    // 2. 量化稠密阶段权重，每行补齐到Int8Kernel::ALIGN的倍数
+    m_WeightScale.assign(neuronCount, 0.0);
+    for (auto& stage : m_Stages) {
+        if (!stage.Dense) {
+            continue;
+        }
+        const size_t cols = stage.SourceEnd - stage.SourceBegin;
+        const size_t padded = Int8Kernel::PaddedSize(cols);
+        double inputRange = *std::max_element(range.begin() + stage.SourceBegin,
+                                              range.begin() + stage.SourceEnd);
+        stage.InputScale = inputRange > 0.0 ? inputRange / Int8Kernel::LIMIT : 1.0;
+        // 各行权重最大绝对值，按层量化时取全阶段最大值
+        const std::vector<double> matrix = StageMatrix(stage);
+        for (size_t i = stage.Begin; i < stage.End; ++i) {
+            double rowRange{0.0};
+            for (size_t c = 0; c < cols; ++c) {
+                rowRange = std::max(rowRange, std::fabs(matrix[(i - stage.Begin) * cols + c]));
+            }
+            m_WeightScale[i] = rowRange;
+        }
+        if (Granularity == QUANTIZATION::PER_LAYER) {
+            const double layerRange = *std::max_element(m_WeightScale.begin() + stage.Begin,
+                                                        m_WeightScale.begin() + stage.End);
+            std::fill(m_WeightScale.begin() + stage.Begin,
+                      m_WeightScale.begin() + stage.End, layerRange);
+        }
+        stage.WeightOffset = m_QuantWeight.size();
+        m_QuantWeight.resize(m_QuantWeight.size() + (stage.End - stage.Begin) * padded, 0);
+        for (size_t i = stage.Begin; i < stage.End; ++i) {
+            double& scale = m_WeightScale[i];
+            scale = scale > 0.0 ? scale / Int8Kernel::LIMIT : 1.0;
+            int8_t* row = &m_QuantWeight[stage.WeightOffset + (i - stage.Begin) * padded];
+            for (size_t c = 0; c < cols; ++c) {
+                long q = std::lround(matrix[(i - stage.Begin) * cols + c] / scale);
+                q = std::max<long>(-Int8Kernel::LIMIT, std::min<long>(Int8Kernel::LIMIT, q));
+                row[c] = static_cast<int8_t>(q);
+            }
+        }
+    }
+    // 3. 释放double打包权重，切换精度
+    m_Double.DenseWeight.clear();
+    m_Double.DenseWeight.shrink_to_fit();
+    m_Precision = PRECISION::INT8;
+}
+
+// 函数名：ForwardQuantized
+// 功能：以int8内核计算一个稠密阶段的加权和。逐样本将源区间输出量化为int8，
+//       与int8权重做int32累加，再乘以权重缩放因子与输入缩放因子反量化
+// 入口参数：const Stage& stage, size_t stride 每个神经元的样本行长度, size_t tile 有效样本数
+// 出口参数：double* values 神经元×样本的输出值矩阵（累加到阶段内神经元）
+// 返回值：无
+void CompiledNetwork::ForwardQuantized(const Stage& stage, double* values,
+                                       size_t stride, size_t tile) const {
+    const size_t rows = stage.End - stage.Begin;
+    const size_t cols = stage.SourceEnd - stage.SourceBegin;
+    const size_t padded = Int8Kernel::PaddedSize(cols);
+    const int8_t* weight = &m_QuantWeight[stage.WeightOffset];
+    const double inverse = 1.0 / stage.InputScale;
+    std::vector<int8_t> input(padded, 0);
+    std::vector<int32_t> sum(rows);
+    for (size_t b = 0; b < tile; ++b) {
+        // 超出校准范围的输入截断到[-127, 127]
+        for (size_t c = 0; c < cols; ++c) {
+            double q = std::nearbyint(values[(stage.SourceBegin + c) * stride + b] * inverse);
+            q = std::max<double>(-Int8Kernel::LIMIT, std::min<double>(Int8Kernel::LIMIT, q));
+            input[c] = static_cast<int8_t>(q);
+        }
+        Int8Kernel::MatVec(weight, rows, padded, input.data(), sum.data());
+        for (size_t r = 0; r < rows; ++r) {
+            values[(stage.Begin + r) * stride + b] +=
+                sum[r] * m_WeightScale[stage.Begin + r] * stage.InputScale;
+        }
+    }
+}
+
+// 函数名：GetParameters
+// 功能：获取精度T下的数值参数
+// 入口参数：无
+// 出口参数：无
+// 返回值：const Parameters<T>& 数值参数
+template<class T>
+const CompiledNetwork::Parameters<T>& CompiledNetwork::GetParameters() const {
+    if constexpr (std::is_same_v<T, float>) {
+        return m_Float;
+    } else {
+        return m_Double;
+    }
+}
+
+// 函数名：Execute
+// 功能：执行批量推理。线程数大于1且样本多于一个BATCH_TILE时，按线程均分为
+//       BATCH_TILE整数倍的样本块，各块在线程池中独立运行RunBatch
+//       （各自分配中间结果缓冲，不共享任何可变状态）
+// 入口参数：const IO* in 行主序输入矩阵, size_t batch 样本数
+// 出口参数：IO* out 行主序输出矩阵
+// 返回值：无
+template<class IO>
+void CompiledNetwork::Execute(const IO* in, size_t batch, IO* out) const {
+    auto run = [this](const IO* chunkIn, size_t count, IO* chunkOut) {
+        if (m_Precision == PRECISION::FLOAT) {
+            std::vector<float> values;
+            RunBatch<float>(chunkIn, count, chunkOut, values);
+        } else {
+            std::vector<double> values;
+            RunBatch<double>(chunkIn, count, chunkOut, values);
+        }
+    };
+    const size_t threads = GetThreadCount();
+    if (threads <= 1 || batch <= BATCH_TILE) {
+        run(in, batch, out);
+        return;
+    }
+    size_t chunk = (batch + threads - 1) / threads;
+    chunk = (chunk + BATCH_TILE - 1) / BATCH_TILE * BATCH_TILE;
+    const size_t inputCount = m_InputIndex.size();
+    const size_t outputCount = m_OutputIndex.size();
+    m_pPool->ParallelFor((batch + chunk - 1) / chunk, [&](size_t index) {
+        const size_t start = index * chunk;
+        run(in + start * inputCount, std::min(chunk, batch - start), out + start * outputCount);
+    });
+}
+
+// 函数名：RunBatch
+// 功能：以精度T逐层对一批样本执行前向传播。样本按BATCH_TILE分块，块内中间结果
+//       按"神经元×样本"存放，每个权重对整块样本只加载一次；单样本时退化为向量计算。
+//       输入输出在边界处于IO与T之间转换
+// 入口参数：const IO* in 行主序输入矩阵, size_t batch 样本数
+// 出口参数：IO* out 行主序输出矩阵, std::vector<T>& values 中间结果缓冲（按需扩大）
+// 返回值：size_t 按散射形式执行的阶段次数（各样本块合计）
+template<class T, class IO>
+size_t CompiledNetwork::RunBatch(const IO* in, size_t batch, IO* out,
+                               std::vector<T>& values) const {
+    const Parameters<T>& params = GetParameters<T>();
+    const size_t inputCount = m_InputIndex.size();
+    const size_t outputCount = m_OutputIndex.size();
+    const size_t neuronCount = m_Activation.size();
+    // 小批量时按实际样本数分配，避免多余的清零与缓存占用
+    const size_t stride = std::min(batch, BATCH_TILE);
+    // 复用的缓冲只增不减；填充样本位置可能残留上次的值，不影响有效样本
+    if (values.size() < neuronCount * stride) {
+        values.resize(neuronCount * stride);
+    }
+    size_t scattered = 0;
+    for (size_t start = 0; start < batch; start += stride) {
+        const size_t tile = std::min(stride, batch - start);
+        // 输入神经元输出值为输入值加偏置
+        for (size_t i = 0; i < inputCount; ++i) {
+            const size_t idx = m_InputIndex[i];
+            T* row = &values[idx * stride];
+            for (size_t b = 0; b < tile; ++b) {
+                row[b] = static_cast<T>(in[(start + b) * inputCount + i]) + params.Bias[idx];
+            }
+        }
+        // 其余神经元按阶段顺序对整块样本累加
+        for (const auto& stage : m_Stages) {
+            scattered += ForwardStage(stage, values.data(), stride, tile) ? 1 : 0;
+        }
+        // 收集输出
+        for (size_t o = 0; o < outputCount; ++o) {
+            const T* row = &values[m_OutputIndex[o] * stride];
+            for (size_t b = 0; b < tile; ++b) {
+                out[(start + b) * outputCount + o] = static_cast<IO>(row[b]);
+            }
+        }
+    }
+    return scattered;
+}
+
+// 函数名：StageMatrix
+// 功能：将阶段的CSR突触展开为行主序稠密矩阵（行数×源区间长度），
+//       缺失连接为零，同一对神经元间的重复突触权重相加
+// 入口参数：const Stage& stage
+// 出口参数：无
+// 返回值：std::vector<double> 稠密权重矩阵
+std::vector<double> CompiledNetwork::StageMatrix(const Stage& stage) const {
+    const size_t cols = stage.SourceEnd - stage.SourceBegin;
+    std::vector<double> matrix((stage.End - stage.Begin) * cols, 0.0);
+    for (size_t i = stage.Begin; i < stage.End; ++i) {
+        for (size_t k = m_RowStart[i]; k < m_RowStart[i + 1]; ++k) {
+            matrix[(i - stage.Begin) * cols + (m_Source[k] - stage.SourceBegin)] += m_Double.Weight[k];
+        }
+    }
+    return matrix;
+}
+
+// 函数名：ForwardStage
+// 功能：计算一个阶段内所有神经元。稠密阶段调用DenseKernel（INT8计划调用Int8Kernel），
+//       稀疏阶段调用SparseKernel按CSR计算；源区间含ReLU神经元的阶段先统计本次源值中
+//       零的比例，达到SCATTER_SPARSITY（多样本时SCATTER_BATCH_SPARSITY）时改为散射形式
+//       （统计只读values，不写入计划，并发推理互不影响）；
+//       最后对激活类型相同的连续神经元
+//       整段调用共享激活函数单例的Apply（每段一次虚调用）
+// 入口参数：const Stage& stage, size_t stride 每个神经元的样本行长度, size_t tile 有效样本数
+// 出口参数：T* values 神经元×样本的输出值矩阵
+// 返回值：bool 是否按散射形式执行
+template<class T>
+bool CompiledNetwork::ForwardStage(const Stage& stage, T* values,
+                                   size_t stride, size_t tile) const {
+    const Parameters<T>& params = GetParameters<T>();
+    for (size_t i = stage.Begin; i < stage.End; ++i) {
+        std::fill(values + i * stride, values + i * stride + tile, params.Bias[i]);
+    }
+    const bool quantized = stage.Dense && m_Precision == PRECISION::INT8;
+    // 统计本次源值稀疏度（源区间只读一遍，相对阶段计算量可忽略）
+    bool scatter = false;
+    if (stage.Scatter && !quantized) {
+        size_t zeros = 0;
+        for (size_t j = stage.SourceBegin; j < stage.SourceEnd; ++j) {
+            const T* row = values + j * stride;
+            for (size_t b = 0; b < tile; ++b) {
+                zeros += row[b] == T(0) ? 1 : 0;
+            }
+        }
+        const size_t sourceValues = (stage.SourceEnd - stage.SourceBegin) * tile;
+        scatter = static_cast<double>(zeros)
+                  >= (stride == 1 ? SCATTER_SPARSITY : SCATTER_BATCH_SPARSITY)
+                     * static_cast<double>(sourceValues);
+    }
+    if (quantized) {
+        // INT8计划始终以double执行非量化部分
+        if constexpr (std::is_same_v<T, double>) {
+            ForwardQuantized(stage, values, stride, tile);
+        }
+    } else if (scatter) {
+        ForwardScatter(stage, values, stride, tile);
+    } else if (stage.Dense) {
+        const T* packed = &params.DenseWeight[stage.WeightOffset];
+        const size_t rows = stage.End - stage.Begin;
+        const size_t cols = stage.SourceEnd - stage.SourceBegin;
+        if (stride == 1) {
+            DenseKernel<T>::MatVec(packed, rows, cols,
+                                   values + stage.SourceBegin, values + stage.Begin);
+        } else {
+            DenseKernel<T>::MatMul(packed, rows, cols,
+                                   values + stage.SourceBegin * stride, stride,
+                                   values + stage.Begin * stride, stride, tile);
+        }
+    } else if (stride == 1) {
+        SparseKernel::SpMV(params.Weight.data(), m_Source.data(), &m_RowStart[stage.Begin],
+                           stage.End - stage.Begin, values, values + stage.Begin);
+    } else {
+        SparseKernel::SpMM(params.Weight.data(), m_Source.data(), &m_RowStart[stage.Begin],
+                           stage.End - stage.Begin, values, stride,
+                           values + stage.Begin * stride, tile);
+    }
+    // 整行（含末块的填充样本）一并计算，使同类型神经元的预激活值连续
+    for (size_t i = stage.Begin; i < stage.End; ) {
+        size_t j = i + 1;
+        while (j < stage.End && m_Activation[j] == m_Activation[i]) {
+            ++j;
+        }
+        T* acc = values + i * stride;
+        ActivationFunction::GetInstance(m_Activation[i], m_Approximation)->Apply(acc, acc, (j - i) * stride);
+        i = j;
+    }
+    return scatter;
+}
@@ -0,0 +1,339 @@
+//
+//  CompiledNetwork.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】CompiledNetwork.hpp
+//【功能模块和目的】编译后的扁平推理计划类声明，将Network对象图冻结为连续数组
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】2026/10/17 增加可选的float32执行模式及精度对比报告
+//            2026/10/17 增加int8训练后量化模式
+//            2026/10/17 增加线程池并行批量推理
+//            2026/10/17 增加可重入推理上下文
+//            2026/10/17 按连接密度选择稠密或CSR稀疏执行，突触源索引改为32位
+//            2026/10/17 不再持有激活函数对象，使用共享单例
+//            2026/10/17 增加按阶段区间分段执行的接口（流水线执行器使用）
+//            2026/10/18 编译时可选Sigmoid、Tanh的快速近似方式
+//            2026/10/18 可只编译指定输出的反向锥
+//            2026/10/18 ReLU源稀疏时自动切换为跳过零值的散射形式
+//            2026/10/18 散射形式按本次调用的源值稀疏度选择，计划不再保存统计状态
+//------------------------------------------------------------------------------
+
+#ifndef CompiledNetwork_hpp
+#define CompiledNetwork_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::shared_ptr所属头文件
+#include <memory>
+//int8_t、uint32_t所属头文件
+#include <cstdint>
+//ActivationFunction类所属头文件
+#include "ActivationFunction.hpp"
+
+// 前向声明网络类，防止循环依赖
+class Network;
+// 前向声明线程池类，仅在实现文件中使用
+class ThreadPool;
+
+//------------------------------------------------------------------------------
+//【类名】CompiledNetwork
+//【功能】编译后的推理计划：神经元按拓扑顺序编号，偏置、激活类型码
+//       与按CSR格式排列的（32位源索引，权重）突触列表均存放于连续数组中。
+//       每个阶段按编译时测得的连接密度选择执行方式：密度不低于DENSE_DENSITY时
+//       展开为打包稠密矩阵，否则以SparseKernel按CSR执行。
+//       源区间含ReLU神经元的阶段另存一份按源列排列的权重，推理时先统计本次
+//       （单样本或一个样本块）源值中零的比例：不低于SCATTER_SPARSITY（多样本时为
+//       SCATTER_BATCH_SPARSITY）时改为散射形式（只把非零源的出边累加到目标），
+//       计算量随非零源数而非突触数变化。选择只依据本次调用的数据，推理不写入计划
+//【接口说明】
+//    默认构造函数（空计划）
+//    以Network为参数编译构造，网络不合理时抛出异常
+//    以Network和校准样本编译INT8量化计划
+//    以Network和输出序号列表只编译这些输出的反向锥
+//    拷贝构造函数、赋值运算符，默认实现
+//    执行推理
+//    执行批量推理（行主序输入矩阵，double或float）
+//    获取神经元数量、突触数量、输入数量、输出数量、稠密阶段数量、计算精度
+//    与参考计划或Network::Inference对比输出偏差
+//    设置、获取批量推理线程数（大批量按线程分块并行，每块使用独立的中间结果缓冲）
+//    使用调用者持有的InferenceContext执行推理，计划本身只读，可被多线程共享
+//    获取阶段数量与各阶段计算量，分段执行（写入输入、计算阶段区间、收集输出），
+//    供流水线执行器把不同阶段区间交给不同线程
+//    推理上下文记录最近一次推理中按散射形式执行的阶段数
+//【精度说明】PRECISION::FLOAT模式在编译时将偏置与权重转换为float，
+//       阶段内累加与矩阵内核均以float进行，激活函数仍以double计算后舍入。
+//       double接口照常可用（输入输出在边界处转换）。在随机初始化的
+//       64-256-256-10 MLP（权重~U(-1,1)/√扇入，输出层线性，输入~U(-1,1)，
+//       1000个样本）上，与double计划相比输出偏差（最大/平均）为：
+//       Sigmoid 4.1e-7/5.2e-8、Tanh 3.1e-7/3.3e-8、ReLU 1.1e-7/1.5e-8；
+//       偏差随层数与扇入增长。同一网络-O2下批量吞吐约为double的1.8倍。
+//       PRECISION::INT8模式由带校准样本的构造函数生成：稠密阶段权重按层或按神经元
+//       对称量化为int8，阶段输入按校准样本上的最大绝对值静态量化为int8，
+//       以Int8Kernel做int8×int8→int32累加后反量化；非稠密阶段与激活函数仍以double计算。
+//       在256-512-512-10 MLP（500个校准样本，另取200个样本对比Network::Inference）上
+//       输出偏差（最大/平均）约为5e-3/1e-3，按神经元与按层量化相差不大；
+//       AVX2/VNNI下权重访存量为double的1/8，批量吞吐约为double计划的1.5～1.8倍
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】2026/10/17 增加PRECISION计算精度选项与DeviationReport
+//            2026/10/17 增加INT8精度、QUANTIZATION量化粒度及与Network的偏差对比
+//            2026/10/17 增加线程池，InferenceBatch按线程分块并行
+//            2026/10/17 增加InferenceContext推理上下文
+//            2026/10/17 增加分段执行接口
+//            2026/10/18 增加只编译指定输出反向锥的构造函数
+//            2026/10/18 增加按实测稀疏度自动选择的散射形式
+//            2026/10/18 去掉共享的稀疏度统计，InferenceContext记录散射阶段数
+//------------------------------------------------------------------------------
+class CompiledNetwork {
+public:
+    //--------------------------------------------------------------------------
+    //内嵌类型
+    //--------------------------------------------------------------------------
+    // 计划内部的计算精度
+    enum class PRECISION {
+        DOUBLE,
+        FLOAT,
+        INT8
+    };
+    // int8量化时权重缩放因子的粒度
+    enum class QUANTIZATION {
+        // 每个稠密阶段（层）一个缩放因子
+        PER_LAYER,
+        // 每个神经元（权重矩阵的一行）一个缩放因子
+        PER_NEURON
+    };
+    // 输出偏差报告：逐个输出值与参考值比较的统计结果
+    class DeviationReport {
+    public:
+        // 最大绝对偏差
+        double MaxAbs{0.0};
+        // 平均绝对偏差
+        double MeanAbs{0.0};
+        // 参与比较的样本数
+        size_t Samples{0};
+    };
+    // 推理上下文：保存单次请求的全部中间结果，由调用者持有。
+    // 每个线程使用各自的上下文，即可让多个线程共享同一只读计划并发推理；
+    // 重复使用同一上下文可避免每次请求重新分配缓冲
+    class InferenceContext {
+    public:
+        // double计算时各神经元的输出值
+        std::vector<double> Values;
+        // float计算时各神经元的输出值
+        std::vector<float> FloatValues;
+        // 最近一次推理的输出值列表
+        std::vector<double> Outputs;
+        // 最近一次推理中按散射形式执行的阶段数
+        size_t ScatterStages{0};
+    };
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 默认构造函数，空计划
+    CompiledNetwork() = default;
+    // 由网络编译生成推理计划，网络不合理时抛出std::runtime_error
+    // Precision为FLOAT时权重在编译时转换为float，推理以float计算
+    // INT8需要校准样本，须使用下一个构造函数，否则抛出std::invalid_argument
+    // Approximation为Sigmoid、Tanh激活的近似方式，见ActivationFunction::APPROXIMATION
+    explicit CompiledNetwork(const Network& ANetwork,
+                             PRECISION Precision = PRECISION::DOUBLE,
+                             ActivationFunction::APPROXIMATION Approximation =
+                                 ActivationFunction::APPROXIMATION::ACCURATE);
+    // 由网络编译生成INT8量化计划，calibration为行主序校准样本矩阵，
+    // 样本矩阵与输入数量不匹配时抛出std::invalid_argument
+    CompiledNetwork(const Network& ANetwork, const std::vector<double>& calibration,
+                    QUANTIZATION Granularity = QUANTIZATION::PER_NEURON);
+    // 只编译OutputIndices所指输出（输出标记序号）的反向锥，输出按该顺序排列，
+    // 输入与完整网络相同；double精度，序号越界时抛出std::out_of_range
+    CompiledNetwork(const Network& ANetwork, const std::vector<size_t>& OutputIndices,
+                    ActivationFunction::APPROXIMATION Approximation);
+    // 拷贝构造函数，默认实现
+    CompiledNetwork(const CompiledNetwork& Source) = default;
+    // 赋值运算符重载，默认实现
+    CompiledNetwork& operator=(const CompiledNetwork& Source) = default;
+    // 虚析构函数，默认实现
+    virtual ~CompiledNetwork() = default;
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 执行推理，输入数量不匹配时返回空列表
+    std::vector<double> Inference(const std::vector<double>& input) const;
+    // 使用上下文执行推理，返回context.Outputs的引用，输入数量不匹配时为空列表
+    const std::vector<double>& Inference(const std::vector<double>& input,
+                                         InferenceContext& context) const;
+    // 执行批量推理，in为batch行×输入数的行主序矩阵，out为batch行×输出数的行主序矩阵
+    void InferenceBatch(const double* in, size_t batch, double* out) const;
+    // 执行批量推理，float输入输出，内部按计划精度计算
+    void InferenceBatch(const float* in, size_t batch, float* out) const;
+    // 获取神经元数量
+    size_t GetNeuronCount() const;
+    // 获取突触数量
+    size_t GetSynapseCount() const;
+    // 获取输入数量
+    size_t GetInputCount() const;
+    // 获取输出数量
+    size_t GetOutputCount() const;
+    // 获取按稠密矩阵内核执行的阶段数量
+    size_t GetDenseStageCount() const;
+    // 获取计划内部的计算精度
+    PRECISION GetPrecision() const;
+    // 获取Sigmoid、Tanh激活的近似方式
+    ActivationFunction::APPROXIMATION GetApproximation() const;
+    // 获取计算阶段数量（拓扑层级），输入神经元不属于任何阶段
+    size_t GetStageCount() const;
+    // 获取计算阶段的估算计算量：稠密阶段为矩阵元素数，稀疏阶段为突触数，另加神经元数
+    size_t GetStageCost(size_t StageIndex) const;
+    // 分段执行：把tile个样本（行主序）的输入写入values，values为神经元×样本矩阵，
+    // 行长度为stride；FLOAT精度的计划抛出std::runtime_error
+    void LoadInputs(const double* in, size_t tile, double* values, size_t stride) const;
+    // 分段执行：计算阶段[Begin, End)，要求此前的阶段已计算完毕
+    void ForwardStages(size_t Begin, size_t End, double* values,
+                       size_t stride, size_t tile) const;
+    // 分段执行：从values收集tile个样本的输出，写为行主序矩阵
+    void StoreOutputs(const double* values, size_t stride, size_t tile, double* out) const;
+    // 以行主序样本矩阵samples分别运行本计划与Reference，统计输出偏差
+    // 输入数量不一致时抛出std::invalid_argument
+    DeviationReport CompareWith(const CompiledNetwork& Reference,
+                                const std::vector<double>& samples) const;
+    // 以行主序样本矩阵samples分别运行本计划与Network::Inference，统计输出偏差
+    DeviationReport CompareWith(Network& ANetwork,
+                                const std::vector<double>& samples) const;
+    // 获取批量推理线程数
+    size_t GetThreadCount() const;
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 设置批量推理线程数（含调用线程），1为单线程；拷贝得到的计划共享同一线程池
+    void SetThreadCount(size_t ThreadCount);
+    // 使用外部线程池（可为空，表示单线程），供网络与计划共享同一线程池
+    void SetThreadPool(const std::shared_ptr<ThreadPool>& pPool);
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 批量推理时每次同时计算的样本数，中间结果按神经元×样本块存放以保持缓存命中
+    static constexpr size_t BATCH_TILE{64};
+    // 阶段按稠密矩阵执行的最低连接密度（突触数/(行数×源区间长度)）。
+    // 512×512层实测：单样本时稀疏gather与稠密内核在密度0.4～0.6间持平，
+    // 64样本批量时在0.15～0.5间持平（随编译选项变化），取折中值
+    static constexpr double DENSE_DENSITY{0.3};
+    // 单样本推理时阶段改为散射形式的最低源值稀疏度（为零的源值比例）。
+    // 256-512-512-512-10 ReLU MLP实测：稠密与10%密度CSR阶段均在0.5～0.55间持平，
+    // 稀疏度0.8时单样本耗时约为原来的30%～45%
+    static constexpr double SCATTER_SPARSITY{0.55};
+    // 批量推理时的阈值：散射形式逐样本执行，稠密阶段在0.7附近才与矩阵内核持平
+    static constexpr double SCATTER_BATCH_SPARSITY{0.7};
+private:
+    //--------------------------------------------------------------------------
+    //私有内嵌类
+    //--------------------------------------------------------------------------
+    // 计算阶段：拓扑层级相同、彼此独立的一段连续神经元
+    class Stage {
+    public:
+        // 阶段内神经元的计划索引范围[Begin, End)
+        size_t Begin{0};
+        size_t End{0};
+        // 稠密阶段的源神经元计划索引范围[SourceBegin, SourceEnd)
+        size_t SourceBegin{0};
+        size_t SourceEnd{0};
+        // 连接密度不低于DENSE_DENSITY，按稠密矩阵内核执行
+        bool Dense{false};
+        // 稠密阶段打包权重在Parameters::DenseWeight（INT8时为m_QuantWeight）中的起始位置
+        size_t WeightOffset{0};
+        // INT8稠密阶段输入的量化缩放因子
+        double InputScale{0.0};
+        // 源区间含ReLU神经元，统计稀疏度并可按散射形式执行
+        bool Scatter{false};
+        // 散射形式各源列的起始位置（相对本阶段，源区间长度+1个）在m_ScatterStart中的起始下标
+        size_t ScatterOffset{0};
+        // 散射形式权重在Parameters::ScatterWeight中的起始位置
+        size_t ScatterWeightOffset{0};
+        // 稀疏阶段散射形式目标索引（相对Begin）在m_ScatterTarget中的起始位置
+        size_t ScatterTargetOffset{0};
+    };
+    // 某一精度下的数值参数
+    template<class T>
+    class Parameters {
+    public:
+        // 各神经元偏置，按拓扑顺序排列
+        std::vector<T> Bias;
+        // 突触权重，与m_Source一一对应
+        std::vector<T> Weight;
+        // 稠密阶段的打包权重（DenseKernel格式）
+        std::vector<T> DenseWeight;
+        // 散射形式权重：稠密阶段按列主序，稀疏阶段按CSC排列
+        std::vector<T> ScatterWeight;
+    };
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 编译推理计划，OutputIndices为nullptr时编译整个网络，否则只编译指定输出的反向锥
+    void Build(const Network& ANetwork, const std::vector<size_t>* OutputIndices);
+    // 将阶段的CSR突触展开为行主序稠密矩阵，重复突触权重相加
+    std::vector<double> StageMatrix(const Stage& stage) const;
+    // 生成阶段按源列排列的散射形式权重，dense时由matrix（行主序）生成
+    void BuildScatter(Stage& stage, const std::vector<double>& matrix);
+    // 按散射形式计算一个阶段的加权和（累加到values），返回非零源值数
+    template<class T>
+    size_t ForwardScatter(const Stage& stage, T* values, size_t stride, size_t tile) const;
+    // 获取精度T下的数值参数
+    template<class T>
+    const Parameters<T>& GetParameters() const;
+    // 计算一个阶段，values为神经元×样本矩阵，stride为行长度，tile为有效样本数；
+    // 返回是否按散射形式执行
+    template<class T>
+    bool ForwardStage(const Stage& stage, T* values,
+                      size_t stride, size_t tile) const;
+    // 校准并量化稠密阶段，切换为INT8精度
+    void Quantize(const std::vector<double>& calibration, QUANTIZATION Granularity);
+    // 以int8内核计算一个稠密阶段的加权和（累加到values）
+    void ForwardQuantized(const Stage& stage, double* values,
+                          size_t stride, size_t tile) const;
+    // 按线程分块并按计划精度执行批量推理
+    template<class IO>
+    void Execute(const IO* in, size_t batch, IO* out) const;
+    // 以精度T执行批量推理，IO为输入输出元素类型，values为中间结果缓冲，
+    // 返回按散射形式执行的阶段次数（各样本块合计）
+    template<class T, class IO>
+    size_t RunBatch(const IO* in, size_t batch, IO* out, std::vector<T>& values) const;
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 计算精度
+    PRECISION m_Precision{PRECISION::DOUBLE};
+    // Sigmoid、Tanh激活的近似方式
+    ActivationFunction::APPROXIMATION m_Approximation{ActivationFunction::APPROXIMATION::ACCURATE};
+    // double参数（偏置与CSR权重始终保留，稠密打包权重仅DOUBLE模式生成）
+    Parameters<double> m_Double;
+    // float参数，仅FLOAT模式生成
+    Parameters<float> m_Float;
+    // INT8稠密阶段的量化权重，每行补齐到Int8Kernel::ALIGN的倍数
+    std::vector<int8_t> m_QuantWeight;
+    // INT8稠密阶段各神经元的权重缩放因子，按计划索引排列
+    std::vector<double> m_WeightScale;
+    // 各神经元激活函数类型码
+    std::vector<int> m_Activation;
+    // CSR行起始位置，第i个神经元的突触位于[m_RowStart[i], m_RowStart[i+1])
+    std::vector<size_t> m_RowStart;
+    // 突触源神经元在计划中的索引
+    std::vector<uint32_t> m_Source;
+    // 输入神经元数量，输入神经元占据计划索引[0, m_InputCount)
+    size_t m_InputCount{0};
+    // 输入标记在计划中的索引，按输入标记顺序排列
+    std::vector<size_t> m_InputIndex;
+    // 输出神经元在计划中的索引，按输出标记顺序排列
+    std::vector<size_t> m_OutputIndex;
+    // 计算阶段列表（不含输入神经元）
+    std::vector<Stage> m_Stages;
+    // 散射形式各源列的起始位置，按阶段分段存放
+    std::vector<size_t> m_ScatterStart;
+    // 稀疏阶段散射形式的目标神经元索引（相对阶段Begin）
+    std::vector<uint32_t> m_ScatterTarget;
+    // 批量推理线程池，单线程时为空
+    std::shared_ptr<ThreadPool> m_pPool;
+};
+
+#endif /* CompiledNetwork_hpp */
@@ -8,7 +8,8 @@
 //【文件名】Container.hpp
 //【功能模块和目的】容器类模版定义及实现，用于存储不同数据类型元素的容器类模版
 //【开发者及日期】孙李智 2025/7/13
-//【更改记录】
+//【更改记录】2026/10/17 构造、下标运算符改为constexpr，元素值初始化，
+//            使静态容器可用于常量求值（C++20）
 //------------------------------------------------------------------------------
 
 #ifndef Container_h
@@ -66,7 +67,7 @@ public:
     // 默认构造函数
     Container() = default;
     // 以CT为参数的构造函数
-    Container(const CT& Source);
+    constexpr Container(const CT& Source);
     // 拷贝构造函数，因无引用类型成员，默认实现
     Container(const Container& Source) = default;
     // 赋值运算符overload，因无引用类型成员，默认实现
@@ -77,12 +78,12 @@ public:
     // 非静态Setter成员函数
     //--------------------------------------------------------------------------
     // 返回元素引用的[]下标运算符overload
-    ET& operator[](size_t Index);
+    constexpr ET& operator[](size_t Index);
     //--------------------------------------------------------------------------
     // 非静态Getter成员函数：需检查所有Getter是否有后置const
     //--------------------------------------------------------------------------
     // 返回元素值的[]下标运算符overload
-    ET operator[](size_t Index) const;
+    constexpr ET operator[](size_t Index) const;
     // 两容器全部元素==相等关系运算符overload
     bool operator==(const Container& AContainer) const;
     // 两容器任一元素!=不等关系运算符overload
@@ -96,7 +97,7 @@ protected:
     // 受保护数据成员
     //--------------------------------------------------------------------------
     // 元素的实际存储
-    CT m_Elements;
+    CT m_Elements{};
 };
 //------------------------------------------------------------------------------
 
@@ -110,7 +111,7 @@ protected:
 // 出口参数：无
 // 返回值：无
 template<class ET, class CT>
-Container<ET, CT>::Container(const CT& Source){
+constexpr Container<ET, CT>::Container(const CT& Source){
     m_Elements = Source;
 }
 //------------------------------------------------------------------------------
@@ -125,7 +126,7 @@ Container<ET, CT>::Container(const CT& Source){
 // 出口参数：无
 // 返回值：指定下标元素的引用
 template<class ET, class CT>
-ET& Container<ET, CT>::operator[](size_t Index){
+constexpr ET& Container<ET, CT>::operator[](size_t Index){
     //超下标范围访问，则抛出异常
     if (Index >= m_Elements.size()) {
         throw INDEX_OUTOFRANGE(Index, m_Elements.size() - 1);
@@ -144,7 +145,7 @@ ET& Container<ET, CT>::operator[](size_t Index){
 // 出口参数：无
 // 返回值：指定下标元素值
 template<class ET, class CT>
-ET Container<ET, CT>::operator[](size_t Index) const{
+constexpr ET Container<ET, CT>::operator[](size_t Index) const{
     // 超下标范围访问，则抛出异常
     if (Index >= m_Elements.size()) {
         throw INDEX_OUTOFRANGE(Index, m_Elements.size() - 1);
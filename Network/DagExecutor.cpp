@@ -0,0 +1,414 @@
+//
+//  DagExecutor.cpp
+//
+//  Created by 孙李智 on 2026/10/18.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】DagExecutor.cpp
+//【功能模块和目的】任务图并行执行器类实现
+//【开发者及日期】孙李智 2026/10/18
+//【更改记录】
+//            2026/10/18 使用网络设置的激活近似方式
+//            2026/10/18 收集、分层与编号改由NetworkGraph完成
+//------------------------------------------------------------------------------
+
+// DagExecutor类所属头文件
+#include "DagExecutor.hpp"
+// Neuron类所属头文件
+#include "Neuron.hpp"
+// NetworkGraph类所属头文件
+#include "NetworkGraph.hpp"
+// Layer类所属头文件
+#include "Layer.hpp"
+// ActivationFunction类所属头文件
+#include "ActivationFunction.hpp"
+// SparseKernel类所属头文件
+#include "SparseKernel.hpp"
+// 异常基类所属头文件
+#include <stdexcept>
+// std::min、std::max所属头文件
+#include <algorithm>
+// std::numeric_limits所属头文件
+#include <limits>
+// 哈希映射头文件，用于存储层、前驱任务到组内位置的映射
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：DagExecutor
+// 功能：构造函数。由NetworkGraph按层级编号后，逐层把神经元归组为任务
+//       （并查集合并共享前驱任务的神经元），
+//       按任务顺序重新编号并填充CSR，再由源神经元所属任务得到依赖计数与后继列表，
+//       最后启动工作线程
+// 入口参数：const Network& ANetwork, size_t ThreadCount 线程总数（含调用线程）
+// 出口参数：无
+// 返回值：无，网络不合理时抛出std::runtime_error
+DagExecutor::DagExecutor(const Network& ANetwork, size_t ThreadCount)
+    : m_Approximation(ANetwork.GetActivationApproximation()) {
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Network is not valid for task graph execution");
+    }
+    // 1. 由NetworkGraph收集神经元并编号：输入神经元在前，其余按层级（最长路径深度）排列
+    const NetworkGraph graph(ANetwork);
+    const size_t count = graph.GetNeuronCount();
+    const size_t inputCount = graph.GetInputCount();
+    const std::vector<size_t>& level = graph.GetLevel();
+    const std::vector<size_t>& rowStart = graph.GetRowStart();
+    const std::vector<uint32_t>& source = graph.GetSource();
+
+    // 2. 逐层级归组：共享前驱任务的神经元合并，没有非输入前驱的按所属层合并
+    const size_t NONE = std::numeric_limits<size_t>::max();
+    std::vector<size_t> taskOf(count, NONE);
+    // 按任务顺序排列的非输入神经元（图编号）
+    std::vector<size_t> placed;
+    size_t next = inputCount;
+    for (size_t begin = inputCount; begin < count; ) {
+        size_t end = begin + 1;
+        while (end < count && level[end] == level[begin]) {
+            ++end;
+        }
+        // 并查集，元素为本层级内的位置
+        std::vector<size_t> parent(end - begin);
+        for (size_t i = 0; i < parent.size(); ++i) {
+            parent[i] = i;
+        }
+        auto find = [&parent](size_t x) {
+            while (parent[x] != x) {
+                parent[x] = parent[parent[x]];
+                x = parent[x];
+            }
+            return x;
+        };
+        std::unordered_map<size_t, size_t> ownerOfTask;
+        std::unordered_map<const Layer*, size_t> ownerOfLayer;
+        for (size_t i = 0; i < parent.size(); ++i) {
+            const size_t idx = begin + i;
+            bool hasTask = false;
+            for (size_t k = rowStart[idx]; k < rowStart[idx + 1]; ++k) {
+                if (taskOf[source[k]] == NONE) {
+                    continue;
+                }
+                hasTask = true;
+                auto found = ownerOfTask.emplace(taskOf[source[k]], i);
+                parent[find(i)] = find(found.first->second);
+            }
+            if (!hasTask) {
+                auto found = ownerOfLayer.emplace(graph.GetNeuron(idx)->GetLayer().get(), i);
+                parent[find(i)] = find(found.first->second);
+            }
+        }
+        // 组按首个成员出现的顺序排列，组内保持层级内顺序
+        std::vector<std::vector<size_t>> groups;
+        std::unordered_map<size_t, size_t> groupOfRoot;
+        for (size_t i = 0; i < parent.size(); ++i) {
+            auto found = groupOfRoot.emplace(find(i), groups.size());
+            if (found.second) {
+                groups.emplace_back();
+            }
+            groups[found.first->second].push_back(begin + i);
+        }
+        for (const auto& group : groups) {
+            for (size_t first = 0; first < group.size(); first += MAX_GROUP_SIZE) {
+                const size_t last = std::min(first + MAX_GROUP_SIZE, group.size());
+                Task task;
+                task.Begin = next;
+                for (size_t k = first; k < last; ++k) {
+                    taskOf[group[k]] = m_Tasks.size();
+                    placed.push_back(group[k]);
+                    ++next;
+                }
+                task.End = next;
+                m_Tasks.push_back(task);
+            }
+        }
+        begin = end;
+    }
+
+    // 3. 按任务顺序重新编号，填充偏置、激活类型与CSR（输入神经元编号不变，无树突）
+    std::vector<size_t> number(count);
+    for (size_t i = 0; i < inputCount; ++i) {
+        number[i] = i;
+    }
+    for (size_t k = 0; k < placed.size(); ++k) {
+        number[placed[k]] = inputCount + k;
+    }
+    const std::vector<double>& bias = graph.GetBias();
+    const std::vector<double>& weight = graph.GetWeight();
+    m_Bias.assign(bias.begin(), bias.begin() + inputCount);
+    m_Activation.assign(inputCount, 0);
+    m_RowStart.assign(inputCount + 1, 0);
+    for (size_t idx : placed) {
+        m_Bias.push_back(bias[idx]);
+        m_Activation.push_back(graph.GetActivation()[idx]);
+        for (size_t k = rowStart[idx]; k < rowStart[idx + 1]; ++k) {
+            m_Source.push_back(static_cast<uint32_t>(number[source[k]]));
+            m_Weight.push_back(weight[k]);
+        }
+        m_RowStart.push_back(m_Source.size());
+    }
+    m_InputIndex = graph.GetInputIndex();
+    for (size_t idx : graph.GetOutputIndex()) {
+        m_OutputIndex.push_back(number[idx]);
+    }
+
+    // 4. 由源神经元所属任务得到依赖计数、后继列表与关键路径长度
+    std::vector<std::vector<uint32_t>> successors(m_Tasks.size());
+    std::vector<size_t> taskDepth(m_Tasks.size(), 1);
+    std::vector<size_t> lastSeen(m_Tasks.size(), NONE);
+    for (size_t t = 0; t < m_Tasks.size(); ++t) {
+        for (size_t row = m_Tasks[t].Begin; row < m_Tasks[t].End; ++row) {
+            const size_t idx = placed[row - inputCount];
+            for (size_t k = rowStart[idx]; k < rowStart[idx + 1]; ++k) {
+                const size_t predecessor = taskOf[source[k]];
+                if (predecessor == NONE || lastSeen[predecessor] == t) {
+                    continue;
+                }
+                lastSeen[predecessor] = t;
+                ++m_Tasks[t].Dependencies;
+                successors[predecessor].push_back(static_cast<uint32_t>(t));
+                taskDepth[t] = std::max(taskDepth[t], taskDepth[predecessor] + 1);
+            }
+        }
+        if (m_Tasks[t].Dependencies == 0) {
+            m_Roots.push_back(static_cast<uint32_t>(t));
+        }
+        m_CriticalPath = std::max(m_CriticalPath, taskDepth[t]);
+    }
+    for (size_t t = 0; t < m_Tasks.size(); ++t) {
+        m_Tasks[t].SuccessorBegin = m_Successors.size();
+        m_Successors.insert(m_Successors.end(), successors[t].begin(), successors[t].end());
+        m_Tasks[t].SuccessorEnd = m_Successors.size();
+    }
+
+    // 5. 分配推理状态并启动工作线程
+    m_Values.assign(count, 0.0);
+    m_Pending.reset(new std::atomic<uint32_t>[m_Tasks.size()]);
+    if (ThreadCount == 0) {
+        ThreadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < ThreadCount; ++i) {
+        m_Deques.push_back(std::make_unique<TaskDeque>());
+    }
+    for (size_t i = 1; i < ThreadCount; ++i) {
+        m_Workers.emplace_back(&DagExecutor::WorkerLoop, this, i);
+    }
+}
+
+// 函数名：~DagExecutor
+// 功能：析构函数，通知工作线程停止并等待其结束
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+DagExecutor::~DagExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_Start.notify_all();
+    for (auto& worker : m_Workers) {
+        worker.join();
+    }
+}
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Inference
+// 功能：单样本推理。写入输入（输入值加偏置）、重置依赖计数，把无前驱的任务放入调用线程的队列后
+//       唤醒工作线程，调用线程同样参与执行，全部任务完成后读取输出
+// 入口参数：const std::vector<double>& input 输入值列表
+// 出口参数：无
+// 返回值：std::vector<double> 输出值列表
+std::vector<double> DagExecutor::Inference(const std::vector<double>& input) {
+    if (input.size() != m_InputIndex.size()) {
+        throw std::invalid_argument("Input size does not match input neuron count");
+    }
+    std::lock_guard<std::mutex> inferenceLock(m_InferenceMutex);
+    for (size_t i = 0; i < input.size(); ++i) {
+        m_Values[m_InputIndex[i]] = input[i] + m_Bias[m_InputIndex[i]];
+    }
+    if (!m_Tasks.empty()) {
+        for (size_t t = 0; t < m_Tasks.size(); ++t) {
+            m_Pending[t].store(m_Tasks[t].Dependencies, std::memory_order_relaxed);
+        }
+        m_Remaining.store(m_Tasks.size(), std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_Deques.front()->Mutex);
+            m_Deques.front()->Tasks.assign(m_Roots.begin(), m_Roots.end());
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            ++m_Generation;
+        }
+        m_Start.notify_all();
+        Work(0);
+    }
+    std::vector<double> output;
+    output.reserve(m_OutputIndex.size());
+    for (size_t index : m_OutputIndex) {
+        output.push_back(m_Values[index]);
+    }
+    return output;
+}
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：GetTaskCount
+// 功能：获取任务数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 任务数
+size_t DagExecutor::GetTaskCount() const {
+    return m_Tasks.size();
+}
+
+// 函数名：GetCriticalPathLength
+// 功能：获取关键路径（最长依赖链）上的任务数，即单次推理的最少串行步数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 任务数
+size_t DagExecutor::GetCriticalPathLength() const {
+    return m_CriticalPath;
+}
+
+// 函数名：GetThreadCount
+// 功能：获取线程总数（含调用线程）
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 线程总数
+size_t DagExecutor::GetThreadCount() const {
+    return m_Deques.size();
+}
+
+// 函数名：GetStealCount
+// 功能：获取自构造以来的累计窃取次数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 窃取次数
+size_t DagExecutor::GetStealCount() const {
+    return m_Steals.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：WorkerLoop
+// 功能：工作线程主循环。等待推理序号变化后参与执行，停止时返回
+// 入口参数：size_t Index 线程编号（从1开始，0为调用线程）
+// 出口参数：无
+// 返回值：无
+void DagExecutor::WorkerLoop(size_t Index) {
+    size_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Start.wait(lock, [this, &seen]() { return m_Stop || m_Generation != seen; });
+            if (m_Stop) {
+                return;
+            }
+            seen = m_Generation;
+        }
+        Work(Index);
+    }
+}
+
+// 函数名：Work
+// 功能：执行任务直至本次推理的全部任务完成。先取自己队尾的任务，没有时窃取；
+//       任务完成后递减各后继的计数，第一个就绪的后继由本线程接着执行，其余放入自己的队列
+// 入口参数：size_t Index 线程编号
+// 出口参数：无
+// 返回值：无
+void DagExecutor::Work(size_t Index) {
+    TaskDeque& own = *m_Deques[Index];
+    while (m_Remaining.load(std::memory_order_acquire) > 0) {
+        uint32_t current = 0;
+        bool found = false;
+        {
+            std::lock_guard<std::mutex> lock(own.Mutex);
+            if (!own.Tasks.empty()) {
+                current = own.Tasks.back();
+                own.Tasks.pop_back();
+                found = true;
+            }
+        }
+        if (!found && !Steal(Index, current)) {
+            std::this_thread::yield();
+            continue;
+        }
+        while (true) {
+            const Task& task = m_Tasks[current];
+            RunTask(task);
+            bool hasNext = false;
+            uint32_t nextTask = 0;
+            for (size_t k = task.SuccessorBegin; k < task.SuccessorEnd; ++k) {
+                const uint32_t successor = m_Successors[k];
+                if (m_Pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    continue;
+                }
+                if (!hasNext) {
+                    nextTask = successor;
+                    hasNext = true;
+                }
+                else {
+                    std::lock_guard<std::mutex> lock(own.Mutex);
+                    own.Tasks.push_back(successor);
+                }
+            }
+            m_Remaining.fetch_sub(1, std::memory_order_acq_rel);
+            if (!hasNext) {
+                break;
+            }
+            current = nextTask;
+        }
+    }
+}
+
+// 函数名：RunTask
+// 功能：计算一个任务的行区间：置为偏置，CSR累加源值，
+//       再对激活类型相同的连续神经元整段调用激活函数单例的Apply
+// 入口参数：const Task& ATask
+// 出口参数：无
+// 返回值：无
+void DagExecutor::RunTask(const Task& ATask) {
+    double* values = m_Values.data();
+    std::copy(m_Bias.begin() + static_cast<std::ptrdiff_t>(ATask.Begin),
+              m_Bias.begin() + static_cast<std::ptrdiff_t>(ATask.End), values + ATask.Begin);
+    SparseKernel::SpMV(m_Weight.data(), m_Source.data(), &m_RowStart[ATask.Begin],
+                       ATask.End - ATask.Begin, values, values + ATask.Begin);
+    for (size_t i = ATask.Begin; i < ATask.End; ) {
+        size_t j = i + 1;
+        while (j < ATask.End && m_Activation[j] == m_Activation[i]) {
+            ++j;
+        }
+        ActivationFunction::GetInstance(m_Activation[i], m_Approximation)
+            ->Apply(values + i, values + i, j - i);
+        i = j;
+    }
+}
+
+// 函数名：Steal
+// 功能：从其他线程（由下一个编号开始轮询）的队首窃取一个任务
+// 入口参数：size_t Index 本线程编号
+// 出口参数：uint32_t& TaskIndex 窃取到的任务
+// 返回值：bool 是否窃取成功
+bool DagExecutor::Steal(size_t Index, uint32_t& TaskIndex) {
+    const size_t count = m_Deques.size();
+    for (size_t k = 1; k < count; ++k) {
+        TaskDeque& victim = *m_Deques[(Index + k) % count];
+        std::lock_guard<std::mutex> lock(victim.Mutex);
+        if (!victim.Tasks.empty()) {
+            TaskIndex = victim.Tasks.front();
+            victim.Tasks.pop_front();
+            m_Steals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,180 @@
+//
+//  DagExecutor.hpp
+//
+//  Created by 孙李智 on 2026/10/18.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】DagExecutor.hpp
+//【功能模块和目的】任务图并行执行器类声明：把神经元分组为任务，按依赖计数
+//       调度到工作窃取线程组，多分支网络的各分支可同时推进，降低单次推理延迟
+//【开发者及日期】孙李智 2026/10/18
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef DagExecutor_hpp
+#define DagExecutor_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//uint32_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::deque所属头文件
+#include <deque>
+//std::unique_ptr所属头文件
+#include <memory>
+//std::thread所属头文件
+#include <thread>
+//std::atomic所属头文件
+#include <atomic>
+//std::mutex所属头文件
+#include <mutex>
+//std::condition_variable所属头文件
+#include <condition_variable>
+//Network类所属头文件
+#include "Network.hpp"
+
+//------------------------------------------------------------------------------
+//【类名】DagExecutor
+//【功能】任务图并行执行器。构造时按GetDendrites()建立神经元依赖关系：
+//       同一层级（最长路径深度）中共享前驱任务的神经元归为一组，
+//       没有非输入前驱的神经元按所属层归组，过大的组按MAX_GROUP_SIZE拆分；
+//       每组为一个任务，依赖计数为其不同前驱任务的个数。
+//       神经元按任务顺序重新编号，每个任务对应连续的CSR行区间。
+//       推理时依赖计数归零的任务立即可运行：每个线程（含调用线程）有自己的
+//       双端队列，从队尾取自己的任务，空闲时从其他线程的队首窃取；
+//       任务完成后递减后继的计数，第一个就绪的后继由本线程直接执行。
+//       因此互不依赖的分支不必等待同层级的其他分支，按层同步的方式下空闲的核心得以利用
+//【接口说明】
+//    以网络和线程总数（含调用线程）为参数构造，网络不合理时抛出std::runtime_error
+//    禁止拷贝构造、赋值
+//    析构时停止并回收全部工作线程
+//    单样本推理（多个线程调用时依次执行），输入长度不符时抛出std::invalid_argument
+//    获取任务数、关键路径任务数、线程总数、累计窃取次数
+//【开发者及日期】 孙李智 2026/10/18
+//【更改记录】
+//------------------------------------------------------------------------------
+class DagExecutor {
+public:
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 以网络、线程总数（含调用线程，0取硬件线程数）为参数构造
+    explicit DagExecutor(const Network& ANetwork, size_t ThreadCount = 0);
+    // 禁止拷贝构造
+    DagExecutor(const DagExecutor&) = delete;
+    // 禁止赋值
+    DagExecutor& operator=(const DagExecutor&) = delete;
+    // 虚析构函数，停止并回收工作线程
+    virtual ~DagExecutor();
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 单样本推理，返回输出值列表
+    std::vector<double> Inference(const std::vector<double>& input);
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取任务数
+    size_t GetTaskCount() const;
+    // 获取关键路径上的任务数
+    size_t GetCriticalPathLength() const;
+    // 获取线程总数（含调用线程）
+    size_t GetThreadCount() const;
+    // 获取累计窃取次数
+    size_t GetStealCount() const;
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 每个任务的最大神经元数
+    static constexpr size_t MAX_GROUP_SIZE{64};
+private:
+    //--------------------------------------------------------------------------
+    //私有内嵌类
+    //--------------------------------------------------------------------------
+    // 任务
+    class Task {
+    public:
+        // 负责的行区间[Begin, End)
+        size_t Begin{0};
+        size_t End{0};
+        // 前驱任务数
+        uint32_t Dependencies{0};
+        // 后继任务在m_Successors中的区间[SuccessorBegin, SuccessorEnd)
+        size_t SuccessorBegin{0};
+        size_t SuccessorEnd{0};
+    };
+    // 线程的任务双端队列：所有者在队尾压入、取出，窃取者从队首取出
+    class TaskDeque {
+    public:
+        // 任务索引
+        std::deque<uint32_t> Tasks;
+        // 保护任务队列
+        std::mutex Mutex;
+    };
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 工作线程主循环：等待推理开始，参与执行直至全部任务完成
+    void WorkerLoop(size_t Index);
+    // 作为第Index个线程执行任务，直至本次推理的全部任务完成
+    void Work(size_t Index);
+    // 执行一个任务：计算其行区间并激活
+    void RunTask(const Task& ATask);
+    // 从其他线程的队首窃取任务，成功时返回true
+    bool Steal(size_t Index, uint32_t& TaskIndex);
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 各神经元偏置（按任务顺序编号，输入神经元在前）
+    std::vector<double> m_Bias;
+    // 各神经元激活函数类型
+    std::vector<int> m_Activation;
+    // Sigmoid、Tanh激活的近似方式（取自网络设置）
+    ActivationFunction::APPROXIMATION m_Approximation;
+    // CSR：各行在源索引、权重数组中的起始位置
+    std::vector<size_t> m_RowStart;
+    // CSR：源神经元编号
+    std::vector<uint32_t> m_Source;
+    // CSR：连接权重
+    std::vector<double> m_Weight;
+    // 输入神经元编号（按输入标记顺序）
+    std::vector<size_t> m_InputIndex;
+    // 输出神经元编号（按输出标记顺序）
+    std::vector<size_t> m_OutputIndex;
+    // 任务（按拓扑顺序）
+    std::vector<Task> m_Tasks;
+    // 各任务的后继任务
+    std::vector<uint32_t> m_Successors;
+    // 没有前驱任务的任务
+    std::vector<uint32_t> m_Roots;
+    // 关键路径任务数
+    size_t m_CriticalPath{0};
+    // 本次推理的神经元值
+    std::vector<double> m_Values;
+    // 本次推理各任务剩余的前驱数
+    std::unique_ptr<std::atomic<uint32_t>[]> m_Pending;
+    // 本次推理尚未完成的任务数
+    std::atomic<size_t> m_Remaining{0};
+    // 各线程的任务队列，第0个属于调用线程
+    std::vector<std::unique_ptr<TaskDeque>> m_Deques;
+    // 累计窃取次数
+    std::atomic<size_t> m_Steals{0};
+    // 推理序号，工作线程据此判断新一次推理开始
+    size_t m_Generation{0};
+    // 是否停止
+    bool m_Stop{false};
+    // 保护推理序号与停止标志
+    std::mutex m_Mutex;
+    // 推理开始或停止时通知工作线程
+    std::condition_variable m_Start;
+    // 串行化Inference
+    std::mutex m_InferenceMutex;
+    // 工作线程，最后构造以保证其他成员已初始化
+    std::vector<std::thread> m_Workers;
+};
+//------------------------------------------------------------------------------
+
+#endif /* DagExecutor_hpp */
@@ -0,0 +1,187 @@
+//
+//  DenseKernel.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】DenseKernel.hpp
+//【功能模块和目的】全连接层稠密矩阵计算内核声明
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】2026/10/17 改为按元素类型参数化的类模版，支持float计算
+//------------------------------------------------------------------------------
+
+#ifndef DenseKernel_hpp
+#define DenseKernel_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::min所属头文件
+#include <algorithm>
+
+//------------------------------------------------------------------------------
+//【类模版名】DenseKernel
+//【功能】全连接层稠密矩阵内核，T为元素类型（double或float）。
+//       权重矩阵按PANEL行分组打包，每组内按列连续存放（第c列的PANEL个权重相邻），
+//       使矩阵-向量、矩阵-矩阵乘法的最内层循环均为连续访存且无归约依赖
+//【接口说明】
+//    静态：打包行主序权重矩阵
+//    静态：获取打包后数组长度
+//    静态：分块、寄存器分片的矩阵-向量乘法（累加到输出）
+//    静态：分块、寄存器分片的矩阵-矩阵乘法（累加到输出）
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+template<class T>
+class DenseKernel {
+public:
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 每组打包的行数（寄存器分片高度）
+    static constexpr size_t PANEL{8};
+    // 矩阵-矩阵乘法中一次计算的样本数（寄存器分片宽度）
+    static constexpr size_t BATCH_STEP{4};
+    // 列方向缓存分块大小，使输入块常驻一级缓存
+    static constexpr size_t BLOCK_K{256};
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    // 获取rows行cols列矩阵打包后的数组长度（末组不足PANEL行时补零）
+    static size_t PackedSize(size_t rows, size_t cols);
+    // 将行主序矩阵W（rows×cols）打包到Packed，可同时完成类型转换
+    template<class ST>
+    static void Pack(const std::vector<ST>& W, size_t rows, size_t cols,
+                     std::vector<T>& Packed);
+    // y[0..rows) += W × x[0..cols)
+    static void MatVec(const T* Packed, size_t rows, size_t cols,
+                       const T* x, T* y);
+    // Y[r][0..n) += Σc W[r][c] × X[c][0..n)，X、Y行间距分别为ldx、ldy
+    static void MatMul(const T* Packed, size_t rows, size_t cols,
+                       const T* X, size_t ldx,
+                       T* Y, size_t ldy, size_t n);
+};
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+//函数名：PackedSize（静态）
+//功能：获取打包后数组长度，行数向上取整到PANEL的倍数
+//入口参数：size_t rows, size_t cols
+//出口参数：无
+//返回值：size_t 打包后元素个数
+template<class T>
+size_t DenseKernel<T>::PackedSize(size_t rows, size_t cols) {
+    return (rows + PANEL - 1) / PANEL * PANEL * cols;
+}
+//------------------------------------------------------------------------------
+
+//函数名：Pack（静态）
+//功能：将行主序矩阵按PANEL行分组、组内按列连续打包，末组不足部分补零
+//入口参数：const std::vector<ST>& W, size_t rows, size_t cols
+//出口参数：std::vector<T>& Packed
+//返回值：无
+template<class T>
+template<class ST>
+void DenseKernel<T>::Pack(const std::vector<ST>& W, size_t rows, size_t cols,
+                          std::vector<T>& Packed) {
+    Packed.assign(PackedSize(rows, cols), T(0));
+    for (size_t r = 0; r < rows; ++r) {
+        T* panel = &Packed[r / PANEL * PANEL * cols];
+        for (size_t c = 0; c < cols; ++c) {
+            panel[c * PANEL + r % PANEL] = static_cast<T>(W[r * cols + c]);
+        }
+    }
+}
+//------------------------------------------------------------------------------
+
+//函数名：MatVec（静态）
+//功能：矩阵-向量乘法并累加到y。列方向按BLOCK_K分块，
+//      每组PANEL行的部分和保存在寄存器中
+//入口参数：const T* Packed, size_t rows, size_t cols, const T* x
+//出口参数：T* y
+//返回值：无
+template<class T>
+void DenseKernel<T>::MatVec(const T* Packed, size_t rows, size_t cols,
+                            const T* x, T* y) {
+    for (size_t k0 = 0; k0 < cols; k0 += BLOCK_K) {
+        const size_t k1 = std::min(cols, k0 + BLOCK_K);
+        for (size_t r0 = 0; r0 < rows; r0 += PANEL) {
+            const T* panel = Packed + r0 * cols;
+            T acc[PANEL] = {};
+            for (size_t c = k0; c < k1; ++c) {
+                const T xc = x[c];
+                const T* w = panel + c * PANEL;
+                for (size_t i = 0; i < PANEL; ++i) {
+                    acc[i] += w[i] * xc;
+                }
+            }
+            const size_t valid = std::min(PANEL, rows - r0);
+            for (size_t i = 0; i < valid; ++i) {
+                y[r0 + i] += acc[i];
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+
+//函数名：MatMul（静态）
+//功能：矩阵-矩阵乘法并累加到Y。列方向按BLOCK_K分块，
+//      以PANEL行×BATCH_STEP样本为寄存器分片
+//入口参数：const T* Packed, size_t rows, size_t cols,
+//          const T* X, size_t ldx, size_t ldy, size_t n
+//出口参数：T* Y
+//返回值：无
+template<class T>
+void DenseKernel<T>::MatMul(const T* Packed, size_t rows, size_t cols,
+                            const T* X, size_t ldx,
+                            T* Y, size_t ldy, size_t n) {
+    for (size_t k0 = 0; k0 < cols; k0 += BLOCK_K) {
+        const size_t k1 = std::min(cols, k0 + BLOCK_K);
+        for (size_t r0 = 0; r0 < rows; r0 += PANEL) {
+            const T* panel = Packed + r0 * cols;
+            const size_t valid = std::min(PANEL, rows - r0);
+            size_t b0 = 0;
+            // 完整的PANEL×BATCH_STEP分片
+            for (; b0 + BATCH_STEP <= n; b0 += BATCH_STEP) {
+                T acc[BATCH_STEP][PANEL] = {};
+                for (size_t c = k0; c < k1; ++c) {
+                    const T* w = panel + c * PANEL;
+                    const T* xc = X + c * ldx + b0;
+                    for (size_t j = 0; j < BATCH_STEP; ++j) {
+                        for (size_t i = 0; i < PANEL; ++i) {
+                            acc[j][i] += w[i] * xc[j];
+                        }
+                    }
+                }
+                for (size_t i = 0; i < valid; ++i) {
+                    T* yr = Y + (r0 + i) * ldy + b0;
+                    for (size_t j = 0; j < BATCH_STEP; ++j) {
+                        yr[j] += acc[j][i];
+                    }
+                }
+            }
+            // 剩余不足BATCH_STEP的样本
+            for (; b0 < n; ++b0) {
+                T acc[PANEL] = {};
+                for (size_t c = k0; c < k1; ++c) {
+                    const T xc = X[c * ldx + b0];
+                    const T* w = panel + c * PANEL;
+                    for (size_t i = 0; i < PANEL; ++i) {
+                        acc[i] += w[i] * xc;
+                    }
+                }
+                for (size_t i = 0; i < valid; ++i) {
+                    Y[(r0 + i) * ldy + b0] += acc[i];
+                }
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+
+#endif /* DenseKernel_hpp */
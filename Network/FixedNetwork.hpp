@@ -0,0 +1,572 @@
+//
+//  FixedNetwork.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】FixedNetwork.hpp
+//【功能模块和目的】编译期网络类模版定义及实现：在常量求值中解析内嵌的ANN文本，
+//       各层规模为模版参数，参数保存在静态容器中，推理无堆分配、无启动开销
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef FixedNetwork_hpp
+#define FixedNetwork_hpp
+
+// constexpr解析依赖C++20（常量求值中的未求值throw、constexpr虚析构）
+#if __cplusplus < 202002L
+#error "FixedNetwork.hpp requires C++20"
+#endif
+
+//StaticContainer类模版所属头文件
+#include "StaticContainer.hpp"
+//size_t所属头文件
+#include <cstddef>
+//uint64_t所属头文件
+#include <cstdint>
+//std::array所属头文件
+#include <array>
+//std::string_view所属头文件
+#include <string_view>
+//std::index_sequence所属头文件
+#include <utility>
+//std::invalid_argument所属头文件
+#include <stdexcept>
+//std::exp、std::tanh所属头文件
+#include <cmath>
+
+//------------------------------------------------------------------------------
+//【类模版名】FixedNetwork
+//【功能】编译期形状的分层网络，Layers为按L行顺序排列的各层神经元数。
+//       静态函数Parse以与Network_ANN_Importer::LoadFromStream相同的文法
+//       （#注释、G名称、N偏置 激活类型、L起止索引、S源 目标 权重，-1表示输入/输出）
+//       解析ANN文本，可在constexpr变量初始化中调用，文本与形状不符时编译失败。
+//       突触只能连接相邻层，权重按层保存为稠密行主序矩阵（缺失的突触为0，
+//       重复的突触权重累加）；输入标记须恰为第0层全部神经元，
+//       输出标记数须等于最后一层神经元数。推理循环边界均为编译期常量
+//【接口说明】
+//    默认构造函数、拷贝构造函数、赋值运算符，默认实现
+//    静态：以ANN文本构造（constexpr）
+//    执行推理
+//    获取偏置、激活类型、权重（constexpr）
+//    静态数据成员：层数、各层规模、神经元数、权重数、输入数、输出数
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+template<size_t... Layers>
+class FixedNetwork {
+public:
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 层数
+    static constexpr size_t LAYER_COUNT{sizeof...(Layers)};
+    // 各层神经元数
+    static constexpr std::array<size_t, LAYER_COUNT> LAYER_SIZE{Layers...};
+    // 神经元总数
+    static constexpr size_t NEURON_COUNT{(Layers + ... + 0)};
+    // 输入数（第0层神经元数）
+    static constexpr size_t INPUT_COUNT{LAYER_SIZE[0]};
+    // 输出数（最后一层神经元数）
+    static constexpr size_t OUTPUT_COUNT{LAYER_SIZE[LAYER_COUNT - 1]};
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    // 获取第Layer层第一个神经元的编号
+    static constexpr size_t LayerBegin(size_t Layer);
+    // 获取第Layer层（Layer≥1）权重矩阵在权重数组中的起始位置
+    static constexpr size_t WeightBegin(size_t Layer);
+    // 权重总数（相邻层规模乘积之和；类定义完成前成员函数不可用于常量求值，故就地计算）
+    static constexpr size_t WEIGHT_COUNT{[]() {
+        size_t count{0};
+        for (size_t i = 1; i < LAYER_COUNT; ++i) {
+            count += LAYER_SIZE[i] * LAYER_SIZE[i - 1];
+        }
+        return count;
+    }()};
+    // 以ANN文本构造，文本不合法或与形状不符时抛出std::invalid_argument
+    // （在常量求值中即为编译错误）
+    static constexpr FixedNetwork Parse(std::string_view Text);
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 默认构造函数，全部参数为0
+    constexpr FixedNetwork() = default;
+    // 拷贝构造函数，默认实现
+    constexpr FixedNetwork(const FixedNetwork& Source) = default;
+    // 赋值运算符重载，默认实现
+    constexpr FixedNetwork& operator=(const FixedNetwork& Source) = default;
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 执行推理，中间结果保存在栈上的定长数组中
+    std::array<double, OUTPUT_COUNT> Inference(
+        const std::array<double, INPUT_COUNT>& input) const;
+    // 获取编号为Neuron的神经元偏置
+    constexpr double GetBias(size_t Neuron) const;
+    // 获取编号为Neuron的神经元激活类型
+    constexpr int GetActivationType(size_t Neuron) const;
+    // 获取第Layer层第Row个神经元来自上一层第Col个神经元的权重
+    constexpr double GetWeight(size_t Layer, size_t Row, size_t Col) const;
+private:
+    //--------------------------------------------------------------------------
+    //形状检查
+    //--------------------------------------------------------------------------
+    static_assert(LAYER_COUNT > 0, "FixedNetwork needs at least one layer");
+    static_assert(((Layers > 0) && ...), "FixedNetwork layers must not be empty");
+    //--------------------------------------------------------------------------
+    //私有静态成员函数：常量求值的文本解析
+    //--------------------------------------------------------------------------
+    // 跳过空白字符
+    static constexpr void SkipSpace(std::string_view& Text);
+    // 读取整数，失败返回false
+    static constexpr bool ReadInteger(std::string_view& Text, long long& Value);
+    // 读取十进制浮点数，失败返回false
+    static constexpr bool ReadDouble(std::string_view& Text, double& Value);
+    // 取出下一行（去掉行尾'\r'），没有剩余内容时返回false
+    static constexpr bool NextLine(std::string_view& Text, std::string_view& Line);
+    // 计算激活值，与ActivationFunction::createAF的类型码一致
+    static double Activate(int Type, double x);
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 依次计算第1层至最后一层
+    template<size_t... L>
+    void ForwardLayers(std::index_sequence<L...>,
+                       std::array<double, NEURON_COUNT>& values) const;
+    // 计算第L层（循环边界为编译期常量）
+    template<size_t L>
+    void ForwardLayer(std::array<double, NEURON_COUNT>& values) const;
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 各神经元偏置，按层顺序编号
+    StaticContainer<double, NEURON_COUNT> m_Bias;
+    // 各神经元激活类型
+    StaticContainer<int, NEURON_COUNT> m_Activation;
+    // 各层权重矩阵（行主序，行为本层神经元，列为上一层神经元）
+    StaticContainer<double, WEIGHT_COUNT> m_Weight;
+    // 第k个输入对应的第0层神经元编号
+    StaticContainer<size_t, INPUT_COUNT> m_InputIndex;
+    // 第k个输出对应的神经元编号
+    StaticContainer<size_t, OUTPUT_COUNT> m_OutputIndex;
+};
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+//函数名：LayerBegin（静态）
+//功能：获取第Layer层第一个神经元的编号
+//入口参数：size_t Layer
+//出口参数：无
+//返回值：size_t 编号
+template<size_t... Layers>
+constexpr size_t FixedNetwork<Layers...>::LayerBegin(size_t Layer) {
+    size_t begin{0};
+    for (size_t i = 0; i < Layer; ++i) {
+        begin += LAYER_SIZE[i];
+    }
+    return begin;
+}
+//------------------------------------------------------------------------------
+
+//函数名：WeightBegin（静态）
+//功能：获取第Layer层权重矩阵的起始位置，Layer为LAYER_COUNT时即为权重总数
+//入口参数：size_t Layer
+//出口参数：无
+//返回值：size_t 起始位置
+template<size_t... Layers>
+constexpr size_t FixedNetwork<Layers...>::WeightBegin(size_t Layer) {
+    size_t begin{0};
+    for (size_t i = 1; i < Layer; ++i) {
+        begin += LAYER_SIZE[i] * LAYER_SIZE[i - 1];
+    }
+    return begin;
+}
+//------------------------------------------------------------------------------
+
+//函数名：Parse（静态）
+//功能：以ANN文本构造网络。第一遍读取N、L行，确定各神经元参数与所在层；
+//      第二遍读取S行，记录输入、输出标记并累加权重（与导入器一样不依赖行的先后）
+//入口参数：std::string_view Text ANN文本
+//出口参数：无
+//返回值：FixedNetwork，不合法时抛出std::invalid_argument
+template<size_t... Layers>
+constexpr FixedNetwork<Layers...> FixedNetwork<Layers...>::Parse(std::string_view Text) {
+    FixedNetwork result;
+    // 文本中第i个N行神经元所在的层与编号
+    std::array<size_t, NEURON_COUNT> layerOf{};
+    std::array<size_t, NEURON_COUNT> indexOf{};
+    std::array<bool, NEURON_COUNT> placed{};
+    size_t neuronCount{0};
+    size_t layerCount{0};
+    // 1. 神经元与层
+    std::string_view rest = Text;
+    std::string_view line;
+    while (NextLine(rest, line)) {
+        SkipSpace(line);
+        if (line.empty()) {
+            continue;
+        }
+        const char tag = line.front();
+        line.remove_prefix(1);
+        if (tag == 'N') {
+            double bias{0.0};
+            long long type{0};
+            if (ReadDouble(line, bias) && ReadInteger(line, type)) {
+                if (neuronCount >= NEURON_COUNT) {
+                    throw std::invalid_argument("ANN text has more neurons than FixedNetwork");
+                }
+                if (type < 0 || type > 3) {
+                    throw std::invalid_argument("ANN text has an unknown activation type");
+                }
+                result.m_Bias[neuronCount] = bias;
+                result.m_Activation[neuronCount] = static_cast<int>(type);
+                ++neuronCount;
+            }
+        } else if (tag == 'L') {
+            long long start{0};
+            long long end{0};
+            if (ReadInteger(line, start) && ReadInteger(line, end)) {
+                if (layerCount >= LAYER_COUNT || start < 0 || end < start
+                    || static_cast<size_t>(end - start + 1) != LAYER_SIZE[layerCount]) {
+                    throw std::invalid_argument("ANN layer does not match FixedNetwork shape");
+                }
+                for (size_t i = 0; i < LAYER_SIZE[layerCount]; ++i) {
+                    const size_t neuron = static_cast<size_t>(start) + i;
+                    if (neuron >= NEURON_COUNT || placed[neuron]) {
+                        throw std::invalid_argument("ANN layer refers to a missing neuron");
+                    }
+                    placed[neuron] = true;
+                    layerOf[neuron] = layerCount;
+                    indexOf[neuron] = LayerBegin(layerCount) + i;
+                }
+                ++layerCount;
+            }
+        }
+    }
+    if (neuronCount != NEURON_COUNT || layerCount != LAYER_COUNT) {
+        throw std::invalid_argument("ANN text does not match FixedNetwork shape");
+    }
+    // 偏置与激活类型按层顺序重新编号
+    FixedNetwork ordered;
+    for (size_t i = 0; i < NEURON_COUNT; ++i) {
+        ordered.m_Bias[indexOf[i]] = result.m_Bias[i];
+        ordered.m_Activation[indexOf[i]] = result.m_Activation[i];
+    }
+    // 2. 突触与输入、输出标记
+    size_t inputCount{0};
+    size_t outputCount{0};
+    std::array<bool, NEURON_COUNT> isInput{};
+    rest = Text;
+    while (NextLine(rest, line)) {
+        SkipSpace(line);
+        if (line.empty() || line.front() != 'S') {
+            continue;
+        }
+        line.remove_prefix(1);
+        long long source{0};
+        long long target{0};
+        double weight{0.0};
+        if (!(ReadInteger(line, source) && ReadInteger(line, target) && ReadDouble(line, weight))) {
+            continue;
+        }
+        // 与导入器一致：引用不存在的神经元时忽略该行
+        const bool sourceValid = source >= 0 && source < static_cast<long long>(NEURON_COUNT);
+        const bool targetValid = target >= 0 && target < static_cast<long long>(NEURON_COUNT);
+        if (source == -1 && targetValid) {
+            const size_t neuron = static_cast<size_t>(target);
+            if (layerOf[neuron] != 0 || isInput[neuron] || inputCount >= INPUT_COUNT) {
+                throw std::invalid_argument("FixedNetwork inputs must be the whole first layer");
+            }
+            isInput[neuron] = true;
+            ordered.m_InputIndex[inputCount++] = indexOf[neuron];
+        } else if (sourceValid && target == -1) {
+            if (outputCount >= OUTPUT_COUNT) {
+                throw std::invalid_argument("ANN text has more outputs than the last layer");
+            }
+            ordered.m_OutputIndex[outputCount++] = indexOf[static_cast<size_t>(source)];
+        } else if (sourceValid && targetValid) {
+            const size_t from = static_cast<size_t>(source);
+            const size_t to = static_cast<size_t>(target);
+            if (layerOf[to] != layerOf[from] + 1) {
+                throw std::invalid_argument("FixedNetwork synapses must join adjacent layers");
+            }
+            const size_t layer = layerOf[to];
+            const size_t row = indexOf[to] - LayerBegin(layer);
+            const size_t col = indexOf[from] - LayerBegin(layer - 1);
+            const size_t position = WeightBegin(layer) + row * LAYER_SIZE[layer - 1] + col;
+            ordered.m_Weight[position] = ordered.m_Weight[position] + weight;
+        }
+    }
+    if (inputCount != INPUT_COUNT || outputCount != OUTPUT_COUNT) {
+        throw std::invalid_argument("ANN input or output markers do not match FixedNetwork shape");
+    }
+    return ordered;
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+//函数名：Inference const
+//功能：执行推理。输入神经元输出为输入值加偏置，其余各层逐层计算
+//      加权和加偏置后应用激活函数，与Network::Inference的计算顺序一致
+//入口参数：const std::array<double, INPUT_COUNT>& input
+//出口参数：无
+//返回值：std::array<double, OUTPUT_COUNT> 输出值
+template<size_t... Layers>
+std::array<double, FixedNetwork<Layers...>::OUTPUT_COUNT>
+FixedNetwork<Layers...>::Inference(const std::array<double, INPUT_COUNT>& input) const {
+    std::array<double, NEURON_COUNT> values{};
+    for (size_t i = 0; i < INPUT_COUNT; ++i) {
+        const size_t neuron = m_InputIndex[i];
+        values[neuron] = input[i] + m_Bias[neuron];
+    }
+    ForwardLayers(std::make_index_sequence<LAYER_COUNT - 1>{}, values);
+    std::array<double, OUTPUT_COUNT> output{};
+    for (size_t i = 0; i < OUTPUT_COUNT; ++i) {
+        output[i] = values[m_OutputIndex[i]];
+    }
+    return output;
+}
+//------------------------------------------------------------------------------
+
+//函数名：GetBias const
+//功能：获取神经元偏置
+//入口参数：size_t Neuron 按层顺序的编号
+//出口参数：无
+//返回值：double 偏置，越界抛出异常
+template<size_t... Layers>
+constexpr double FixedNetwork<Layers...>::GetBias(size_t Neuron) const {
+    return m_Bias[Neuron];
+}
+//------------------------------------------------------------------------------
+
+//函数名：GetActivationType const
+//功能：获取神经元激活类型
+//入口参数：size_t Neuron 按层顺序的编号
+//出口参数：无
+//返回值：int 激活类型，越界抛出异常
+template<size_t... Layers>
+constexpr int FixedNetwork<Layers...>::GetActivationType(size_t Neuron) const {
+    return m_Activation[Neuron];
+}
+//------------------------------------------------------------------------------
+
+//函数名：GetWeight const
+//功能：获取相邻层之间的权重
+//入口参数：size_t Layer 本层（≥1），size_t Row 本层内序号，size_t Col 上一层内序号
+//出口参数：无
+//返回值：double 权重，无突触时为0，越界抛出异常
+template<size_t... Layers>
+constexpr double FixedNetwork<Layers...>::GetWeight(size_t Layer, size_t Row,
+                                                    size_t Col) const {
+    if (Layer == 0 || Layer >= LAYER_COUNT
+        || Row >= LAYER_SIZE[Layer] || Col >= LAYER_SIZE[Layer - 1]) {
+        throw std::invalid_argument("FixedNetwork weight index is out of range");
+    }
+    return m_Weight[WeightBegin(Layer) + Row * LAYER_SIZE[Layer - 1] + Col];
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//私有静态成员函数
+//------------------------------------------------------------------------------
+
+//函数名：SkipSpace（静态）
+//功能：跳过开头的空白字符
+//入口参数：std::string_view& Text
+//出口参数：std::string_view& Text
+//返回值：无
+template<size_t... Layers>
+constexpr void FixedNetwork<Layers...>::SkipSpace(std::string_view& Text) {
+    while (!Text.empty() && (Text.front() == ' ' || Text.front() == '\t'
+                             || Text.front() == '\r' || Text.front() == '\n')) {
+        Text.remove_prefix(1);
+    }
+}
+//------------------------------------------------------------------------------
+
+//函数名：ReadInteger（静态）
+//功能：读取可带符号的十进制整数
+//入口参数：std::string_view& Text
+//出口参数：std::string_view& Text 剩余文本，long long& Value
+//返回值：bool 成功返回true
+template<size_t... Layers>
+constexpr bool FixedNetwork<Layers...>::ReadInteger(std::string_view& Text, long long& Value) {
+    SkipSpace(Text);
+    bool negative{false};
+    if (!Text.empty() && (Text.front() == '-' || Text.front() == '+')) {
+        negative = Text.front() == '-';
+        Text.remove_prefix(1);
+    }
+    if (Text.empty() || Text.front() < '0' || Text.front() > '9') {
+        return false;
+    }
+    long long value{0};
+    while (!Text.empty() && Text.front() >= '0' && Text.front() <= '9') {
+        value = value * 10 + (Text.front() - '0');
+        Text.remove_prefix(1);
+    }
+    Value = negative ? -value : value;
+    return true;
+}
+//------------------------------------------------------------------------------
+
+//函数名：ReadDouble（静态）
+//功能：读取十进制浮点数（可带符号、小数部分与指数）。有效数字不超过2^53且
+//      十进制指数绝对值不超过22时只做一次正确舍入的乘除，结果与std::strtod一致
+//入口参数：std::string_view& Text
+//出口参数：std::string_view& Text 剩余文本，double& Value
+//返回值：bool 成功返回true
+template<size_t... Layers>
+constexpr bool FixedNetwork<Layers...>::ReadDouble(std::string_view& Text, double& Value) {
+    SkipSpace(Text);
+    bool negative{false};
+    if (!Text.empty() && (Text.front() == '-' || Text.front() == '+')) {
+        negative = Text.front() == '-';
+        Text.remove_prefix(1);
+    }
+    uint64_t mantissa{0};
+    int exponent{0};
+    bool digits{false};
+    auto readDigits = [&](bool fraction) {
+        while (!Text.empty() && Text.front() >= '0' && Text.front() <= '9') {
+            digits = true;
+            if (mantissa < 100000000000000000ULL) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(Text.front() - '0');
+                exponent -= fraction ? 1 : 0;
+            } else {
+                exponent += fraction ? 0 : 1;
+            }
+            Text.remove_prefix(1);
+        }
+    };
+    readDigits(false);
+    if (!Text.empty() && Text.front() == '.') {
+        Text.remove_prefix(1);
+        readDigits(true);
+    }
+    if (!digits) {
+        return false;
+    }
+    if (!Text.empty() && (Text.front() == 'e' || Text.front() == 'E')) {
+        std::string_view exponentText = Text.substr(1);
+        long long power{0};
+        if (ReadInteger(exponentText, power)) {
+            exponent += static_cast<int>(power);
+            Text = exponentText;
+        }
+    }
+    double value = static_cast<double>(mantissa);
+    // 10的0~22次幂均可由double精确表示
+    constexpr double POWER[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+                                1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+                                1e20, 1e21, 1e22};
+    while (exponent > 22) {
+        value *= POWER[22];
+        exponent -= 22;
+    }
+    while (exponent < -22) {
+        value /= POWER[22];
+        exponent += 22;
+    }
+    value = exponent >= 0 ? value * POWER[exponent] : value / POWER[-exponent];
+    Value = negative ? -value : value;
+    return true;
+}
+//------------------------------------------------------------------------------
+
+//函数名：NextLine（静态）
+//功能：从文本中取出下一行
+//入口参数：std::string_view& Text
+//出口参数：std::string_view& Text 剩余文本，std::string_view& Line 该行（不含换行符）
+//返回值：bool 取到一行返回true
+template<size_t... Layers>
+constexpr bool FixedNetwork<Layers...>::NextLine(std::string_view& Text,
+                                                 std::string_view& Line) {
+    if (Text.empty()) {
+        return false;
+    }
+    const size_t end = Text.find('\n');
+    Line = Text.substr(0, end);
+    Text = end == std::string_view::npos ? std::string_view{} : Text.substr(end + 1);
+    if (!Line.empty() && Line.back() == '\r') {
+        Line.remove_suffix(1);
+    }
+    return true;
+}
+//------------------------------------------------------------------------------
+
+//函数名：Activate（静态）
+//功能：计算激活值，直接内联，不经虚函数调用
+//入口参数：int Type 激活类型，double x
+//出口参数：无
+//返回值：double 激活值
+template<size_t... Layers>
+double FixedNetwork<Layers...>::Activate(int Type, double x) {
+    switch (Type) {
+        // Sigmoid激活
+        case 1:
+            return 1.0 / (1.0 + std::exp(-x));
+        // Tanh激活
+        case 2:
+            return std::tanh(x);
+        // ReLU激活
+        case 3:
+            return (x > 0.0) ? x : 0.0;
+        // 线性激活
+        default:
+            return x;
+    }
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+//函数名：ForwardLayers const
+//功能：以折叠表达式依次展开第1层至最后一层的计算
+//入口参数：std::index_sequence<L...> 层序号减1
+//出口参数：std::array<double, NEURON_COUNT>& values
+//返回值：无
+template<size_t... Layers>
+template<size_t... L>
+void FixedNetwork<Layers...>::ForwardLayers(std::index_sequence<L...>,
+                                            std::array<double, NEURON_COUNT>& values) const {
+    (ForwardLayer<L + 1>(values), ...);
+}
+//------------------------------------------------------------------------------
+
+//函数名：ForwardLayer const
+//功能：计算第L层各神经元输出，行数、列数与偏移均为编译期常量
+//入口参数：无
+//出口参数：std::array<double, NEURON_COUNT>& values
+//返回值：无
+template<size_t... Layers>
+template<size_t L>
+void FixedNetwork<Layers...>::ForwardLayer(std::array<double, NEURON_COUNT>& values) const {
+    constexpr size_t ROWS{LAYER_SIZE[L]};
+    constexpr size_t COLS{LAYER_SIZE[L - 1]};
+    constexpr size_t BEGIN{LayerBegin(L)};
+    constexpr size_t SOURCE{LayerBegin(L - 1)};
+    constexpr size_t WEIGHT{WeightBegin(L)};
+    for (size_t r = 0; r < ROWS; ++r) {
+        double sum{0.0};
+        for (size_t c = 0; c < COLS; ++c) {
+            sum += m_Weight[WEIGHT + r * COLS + c] * values[SOURCE + c];
+        }
+        sum += m_Bias[BEGIN + r];
+        values[BEGIN + r] = Activate(m_Activation[BEGIN + r], sum);
+    }
+}
+//------------------------------------------------------------------------------
+
+#endif /* FixedNetwork_hpp */
@@ -0,0 +1,250 @@
+//
+//  InferenceCache.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】InferenceCache.cpp
+//【功能模块和目的】推理结果缓存类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+// InferenceCache类所属头文件
+#include "InferenceCache.hpp"
+// std::memcpy、std::memcmp所属头文件
+#include <cstring>
+// std::prev所属头文件
+#include <iterator>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：InferenceCache
+// 功能：以容量为参数构造
+// 入口参数：size_t Capacity 容量，0表示不缓存
+// 出口参数：无
+// 返回值：无
+InferenceCache::InferenceCache(size_t Capacity) : m_Capacity(Capacity) {
+}
+
+// 函数名：InferenceCache
+// 功能：拷贝构造函数，复制记录后重建索引
+// 入口参数：const InferenceCache& Source
+// 出口参数：无
+// 返回值：无
+InferenceCache::InferenceCache(const InferenceCache& Source)
+    : m_Entries(Source.m_Entries),
+      m_Capacity(Source.m_Capacity),
+      m_Generation(Source.m_Generation),
+      m_Statistics(Source.m_Statistics) {
+    RebuildIndex();
+}
+
+// 函数名：operator=
+// 功能：赋值运算符重载，复制记录后重建索引
+// 入口参数：const InferenceCache& Source
+// 出口参数：无
+// 返回值：InferenceCache&，指向自身的引用
+InferenceCache& InferenceCache::operator=(const InferenceCache& Source) {
+    if (this != &Source) {
+        m_Entries = Source.m_Entries;
+        m_Capacity = Source.m_Capacity;
+        m_Generation = Source.m_Generation;
+        m_Statistics = Source.m_Statistics;
+        RebuildIndex();
+    }
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：SetCapacity
+// 功能：设置容量，超出部分按最久未使用淘汰
+// 入口参数：size_t Capacity 容量，0表示关闭缓存
+// 出口参数：无
+// 返回值：无
+void InferenceCache::SetCapacity(size_t Capacity) {
+    m_Capacity = Capacity;
+    Shrink();
+}
+
+// 函数名：Find
+// 功能：查找输入对应的结果。版本号不一致时先整体失效；
+//       命中时把记录移到表头（链表节点不移动，索引中的迭代器仍有效）
+// 入口参数：const std::vector<double>& input, size_t Generation 当前结构版本号
+// 出口参数：无
+// 返回值：命中时为结果指针（下次修改缓存前有效），否则为nullptr
+const std::vector<double>* InferenceCache::Find(const std::vector<double>& input,
+                                               size_t Generation) {
+    if (m_Capacity == 0) {
+        return nullptr;
+    }
+    if (Generation != m_Generation) {
+        if (!m_Entries.empty()) {
+            ++m_Statistics.Invalidations;
+        }
+        Clear();
+        m_Generation = Generation;
+    }
+    const uint64_t key = Hash(input);
+    auto range = m_Index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (SameInput(it->second->Input, input)) {
+            m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+            ++m_Statistics.Hits;
+            return &m_Entries.front().Output;
+        }
+    }
+    ++m_Statistics.Misses;
+    return nullptr;
+}
+
+// 函数名：Insert
+// 功能：写入输入对应的结果，已有相同输入时更新结果，容量已满时淘汰表尾记录
+// 入口参数：const std::vector<double>& input, const std::vector<double>& output,
+//          size_t Generation 结果对应的结构版本号
+// 出口参数：无
+// 返回值：无
+void InferenceCache::Insert(const std::vector<double>& input,
+                            const std::vector<double>& output,
+                            size_t Generation) {
+    if (m_Capacity == 0) {
+        return;
+    }
+    if (Generation != m_Generation) {
+        Clear();
+        m_Generation = Generation;
+    }
+    const uint64_t key = Hash(input);
+    auto range = m_Index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (SameInput(it->second->Input, input)) {
+            it->second->Output = output;
+            m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+            return;
+        }
+    }
+    m_Entries.push_front(Entry{key, input, output});
+    m_Index.emplace(key, m_Entries.begin());
+    Shrink();
+}
+
+// 函数名：Clear
+// 功能：清空缓存记录，统计保留
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceCache::Clear() {
+    m_Entries.clear();
+    m_Index.clear();
+}
+
+// 函数名：ResetStatistics
+// 功能：清零命中统计
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceCache::ResetStatistics() {
+    m_Statistics = Statistics();
+}
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：GetCapacity
+// 功能：获取容量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 容量
+size_t InferenceCache::GetCapacity() const {
+    return m_Capacity;
+}
+
+// 函数名：GetStatistics
+// 功能：获取缓存统计
+// 入口参数：无
+// 出口参数：无
+// 返回值：Statistics 统计副本，含当前记录数与容量
+InferenceCache::Statistics InferenceCache::GetStatistics() const {
+    Statistics result = m_Statistics;
+    result.Size = m_Entries.size();
+    result.Capacity = m_Capacity;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Hash（静态）
+// 功能：计算输入向量的哈希值。逐元素取64位位模式，异或后乘奇常数、移位混合，
+//       最后做一次完整的位扩散；每个元素只需一次乘法
+// 入口参数：const std::vector<double>& input
+// 出口参数：无
+// 返回值：uint64_t 哈希值
+uint64_t InferenceCache::Hash(const std::vector<double>& input) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ input.size();
+    for (double value : input) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        h = (h ^ bits) * 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 31;
+    }
+    h ^= h >> 33;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 29;
+    return h;
+}
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：SameInput（静态）
+// 功能：逐位比较两个输入向量，与哈希使用相同的相等定义
+// 入口参数：const std::vector<double>& a, const std::vector<double>& b
+// 出口参数：无
+// 返回值：bool 长度与每个元素的位模式都相同时为true
+bool InferenceCache::SameInput(const std::vector<double>& a,
+                               const std::vector<double>& b) {
+    return a.size() == b.size()
+        && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+}
+
+// 函数名：RebuildIndex
+// 功能：由记录链表重建哈希索引
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceCache::RebuildIndex() {
+    m_Index.clear();
+    for (auto it = m_Entries.begin(); it != m_Entries.end(); ++it) {
+        m_Index.emplace(it->Key, it);
+    }
+}
+
+// 函数名：Shrink
+// 功能：从表尾淘汰记录直到不超过容量
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceCache::Shrink() {
+    while (m_Entries.size() > m_Capacity) {
+        auto last = std::prev(m_Entries.end());
+        auto range = m_Index.equal_range(last->Key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == last) {
+                m_Index.erase(it);
+                break;
+            }
+        }
+        m_Entries.pop_back();
+        ++m_Statistics.Evictions;
+    }
+}
@@ -0,0 +1,147 @@
+//
+//  InferenceCache.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】InferenceCache.hpp
+//【功能模块和目的】推理结果缓存类声明：以输入向量为键的有界LRU缓存，
+//       按网络结构版本号自动失效
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef InferenceCache_hpp
+#define InferenceCache_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//uint64_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::list所属头文件
+#include <list>
+//std::unordered_multimap所属头文件
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+//【类名】InferenceCache
+//【功能】推理结果的有界LRU缓存。键为输入向量，按各元素的位模式计算64位哈希，
+//       哈希相同时再逐位比较输入，保证不会返回其他输入的结果；
+//       每条记录带有写入时的网络结构版本号，查找时版本号不一致则清空缓存
+//       （网络结构、偏置、权重的修改都会刷新版本号）。容量为0表示不缓存
+//【接口说明】
+//    以容量为参数构造（默认不缓存）
+//    拷贝构造函数、赋值运算符，默认实现
+//    设置、获取容量
+//    按输入和版本号查找、写入结果
+//    清空缓存
+//    获取、清零命中统计
+//    静态：计算输入向量的哈希值
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+class InferenceCache {
+public:
+    //--------------------------------------------------------------------------
+    //与数据交换相关的内嵌类
+    //--------------------------------------------------------------------------
+    // 缓存统计
+    class Statistics {
+    public:
+        // 命中次数
+        size_t Hits{0};
+        // 未命中次数
+        size_t Misses{0};
+        // 因容量不足淘汰的记录数
+        size_t Evictions{0};
+        // 因版本号变化整体失效的次数
+        size_t Invalidations{0};
+        // 当前记录数
+        size_t Size{0};
+        // 容量
+        size_t Capacity{0};
+    };
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 以容量为参数构造，0表示不缓存
+    explicit InferenceCache(size_t Capacity = 0);
+    // 拷贝构造函数：索引中的迭代器指向源对象的链表，需重建
+    InferenceCache(const InferenceCache& Source);
+    // 赋值运算符重载
+    InferenceCache& operator=(const InferenceCache& Source);
+    // 虚析构函数，默认实现
+    virtual ~InferenceCache() = default;
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 设置容量，超出部分按最久未使用淘汰；0表示关闭缓存并清空
+    void SetCapacity(size_t Capacity);
+    // 查找输入对应的结果，命中时移到最近使用位置并返回结果指针，否则返回nullptr；
+    // Generation与缓存内容的版本号不一致时先清空缓存
+    const std::vector<double>* Find(const std::vector<double>& input,
+                                    size_t Generation);
+    // 写入输入对应的结果，容量已满时淘汰最久未使用的记录
+    void Insert(const std::vector<double>& input,
+                const std::vector<double>& output,
+                size_t Generation);
+    // 清空缓存（不清零统计）
+    void Clear();
+    // 清零命中统计
+    void ResetStatistics();
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取容量
+    size_t GetCapacity() const;
+    // 获取缓存统计
+    Statistics GetStatistics() const;
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    // 计算输入向量的哈希值（逐元素位模式乘法-移位混合）
+    static uint64_t Hash(const std::vector<double>& input);
+private:
+    //--------------------------------------------------------------------------
+    //私有内嵌类
+    //--------------------------------------------------------------------------
+    // 缓存记录
+    class Entry {
+    public:
+        // 输入哈希值
+        uint64_t Key{0};
+        // 输入向量
+        std::vector<double> Input;
+        // 推理结果
+        std::vector<double> Output;
+    };
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 逐位比较两个输入向量
+    static bool SameInput(const std::vector<double>& a,
+                          const std::vector<double>& b);
+    // 由记录链表重建哈希索引
+    void RebuildIndex();
+    // 淘汰最久未使用的记录直到不超过容量
+    void Shrink();
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 记录链表，表头为最近使用
+    std::list<Entry> m_Entries;
+    // 哈希值到记录的索引（哈希冲突时一个键对应多条记录）
+    std::unordered_multimap<uint64_t, std::list<Entry>::iterator> m_Index;
+    // 容量
+    size_t m_Capacity{0};
+    // 缓存内容对应的网络结构版本号，0表示尚无内容
+    size_t m_Generation{0};
+    // 缓存统计（不含Size、Capacity）
+    Statistics m_Statistics;
+};
+//------------------------------------------------------------------------------
+
+#endif /* InferenceCache_hpp */
@@ -0,0 +1,229 @@
+//
+//  InferenceQueue.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】InferenceQueue.cpp
+//【功能模块和目的】异步推理队列类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/18 先记录统计再兑现结果，调用者拿到结果时统计已包含该请求
+//------------------------------------------------------------------------------
+
+// InferenceQueue类所属头文件
+#include "InferenceQueue.hpp"
+// 异常基类所属头文件
+#include <stdexcept>
+// std::min、std::max、std::nth_element、std::max_element所属头文件
+#include <algorithm>
+// std::ceil所属头文件
+#include <cmath>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：InferenceQueue
+// 功能：构造函数，预先分配批次矩阵并启动调度线程
+// 入口参数：const Network& ANetwork, size_t MaxBatchSize 最大批大小（0视为1）,
+//          std::chrono::microseconds MaxWait 最早请求的最长等待时间
+// 出口参数：无
+// 返回值：无，网络不合理时抛出std::runtime_error
+InferenceQueue::InferenceQueue(const Network& ANetwork, size_t MaxBatchSize,
+                               std::chrono::microseconds MaxWait)
+    : m_Network(ANetwork),
+      m_MaxBatchSize(std::max<size_t>(MaxBatchSize, 1)),
+      m_MaxWait(MaxWait),
+      m_InputCount(ANetwork.GetInputMarker().size()),
+      m_OutputCount(ANetwork.GetOutputMarker().size()) {
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Network is not valid");
+    }
+    m_Input.resize(m_MaxBatchSize * m_InputCount);
+    m_Output.resize(m_MaxBatchSize * m_OutputCount);
+    m_Latencies.reserve(LATENCY_WINDOW);
+    m_Dispatcher = std::thread(&InferenceQueue::DispatchLoop, this);
+}
+
+// 函数名：~InferenceQueue
+// 功能：析构函数，通知调度线程停止，已提交的请求不再等待、立即处理完毕
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+InferenceQueue::~InferenceQueue() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_RequestReady.notify_all();
+    m_Dispatcher.join();
+}
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Submit
+// 功能：提交一个请求。只在队列由空变为非空（开始计时）或凑满一批时唤醒调度线程
+// 入口参数：std::vector<double> input 输入向量
+// 出口参数：无
+// 返回值：std::future<std::vector<double>> 输出向量，推理失败时get()抛出推理异常
+std::future<std::vector<double>> InferenceQueue::Submit(std::vector<double> input) {
+    if (input.size() != m_InputCount) {
+        throw std::invalid_argument("Input size does not match input neuron count");
+    }
+    Request request;
+    request.Input = std::move(input);
+    request.Arrival = Clock::now();
+    std::future<std::vector<double>> result = request.Result.get_future();
+    bool notify{false};
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Pending.push_back(std::move(request));
+        notify = m_Pending.size() == 1 || m_Pending.size() >= m_MaxBatchSize;
+    }
+    if (notify) {
+        m_RequestReady.notify_one();
+    }
+    return result;
+}
+
+// 函数名：ResetStatistics
+// 功能：清零统计与延迟记录
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceQueue::ResetStatistics() {
+    std::lock_guard<std::mutex> lock(m_StatisticsMutex);
+    m_Statistics = Statistics();
+    m_Latencies.clear();
+    m_LatencyNext = 0;
+}
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：GetStatistics
+// 功能：获取统计，延迟分位数按最近邻秩法由延迟窗口计算
+// 入口参数：无
+// 出口参数：无
+// 返回值：Statistics 统计副本
+InferenceQueue::Statistics InferenceQueue::GetStatistics() const {
+    std::vector<double> latencies;
+    Statistics result;
+    {
+        std::lock_guard<std::mutex> lock(m_StatisticsMutex);
+        result = m_Statistics;
+        latencies = m_Latencies;
+    }
+    if (!latencies.empty()) {
+        auto percentile = [&latencies](double p) {
+            const size_t rank = static_cast<size_t>(
+                std::ceil(p * static_cast<double>(latencies.size())));
+            auto nth = latencies.begin() + static_cast<std::ptrdiff_t>(std::max<size_t>(rank, 1) - 1);
+            std::nth_element(latencies.begin(), nth, latencies.end());
+            return *nth;
+        };
+        result.P50Latency = percentile(0.50);
+        result.P99Latency = percentile(0.99);
+        result.MaxLatency = *std::max_element(latencies.begin(), latencies.end());
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：DispatchLoop
+// 功能：调度线程主循环。等待队列非空，再等待凑满一批或最早请求到期（停止时不再等待），
+//       取出至多MaxBatchSize个请求后释放锁执行推理；停止且队列为空时返回
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceQueue::DispatchLoop() {
+    std::vector<Request> batch;
+    batch.reserve(m_MaxBatchSize);
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_RequestReady.wait(lock, [this]() { return m_Stop || !m_Pending.empty(); });
+        if (m_Pending.empty()) {
+            return;
+        }
+        const Clock::time_point deadline = m_Pending.front().Arrival + m_MaxWait;
+        m_RequestReady.wait_until(lock, deadline, [this]() {
+            return m_Stop || m_Pending.size() >= m_MaxBatchSize;
+        });
+        const size_t count = std::min(m_Pending.size(), m_MaxBatchSize);
+        batch.clear();
+        for (size_t i = 0; i < count; ++i) {
+            batch.push_back(std::move(m_Pending.front()));
+            m_Pending.pop_front();
+        }
+        lock.unlock();
+        RunBatch(batch);
+        lock.lock();
+    }
+}
+
+// 函数名：RunBatch
+// 功能：把批次输入拼成行主序矩阵执行批量推理，记录统计后兑现各请求结果
+// 入口参数：std::vector<Request>& Batch
+// 出口参数：std::vector<Request>& Batch 各请求的promise被兑现
+// 返回值：无
+void InferenceQueue::RunBatch(std::vector<Request>& Batch) {
+    const size_t rows = Batch.size();
+    for (size_t r = 0; r < rows; ++r) {
+        std::copy(Batch[r].Input.begin(), Batch[r].Input.end(),
+                  m_Input.begin() + static_cast<std::ptrdiff_t>(r * m_InputCount));
+    }
+    try {
+        m_Network.InferenceBatch(m_Input.data(), rows, m_Output.data());
+    } catch (...) {
+        for (auto& request : Batch) {
+            request.Result.set_exception(std::current_exception());
+        }
+        return;
+    }
+    const Clock::time_point done = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(m_StatisticsMutex);
+        RecordBatch(Batch, done);
+    }
+    for (size_t r = 0; r < rows; ++r) {
+        const auto begin = m_Output.begin() + static_cast<std::ptrdiff_t>(r * m_OutputCount);
+        Batch[r].Result.set_value(std::vector<double>(begin, begin + static_cast<std::ptrdiff_t>(m_OutputCount)));
+    }
+}
+
+// 函数名：RecordBatch
+// 功能：记录一个批次的延迟与批大小统计，调用者需持有m_StatisticsMutex
+// 入口参数：const std::vector<Request>& Batch, Clock::time_point Done 完成时刻
+// 出口参数：无
+// 返回值：无
+void InferenceQueue::RecordBatch(const std::vector<Request>& Batch, Clock::time_point Done) {
+    const size_t rows = Batch.size();
+    for (const auto& request : Batch) {
+        const double latency =
+            std::chrono::duration<double, std::micro>(Done - request.Arrival).count();
+        if (m_Latencies.size() < LATENCY_WINDOW) {
+            m_Latencies.push_back(latency);
+        }
+        else {
+            m_Latencies[m_LatencyNext] = latency;
+        }
+        m_LatencyNext = (m_LatencyNext + 1) % LATENCY_WINDOW;
+    }
+    m_Statistics.Requests += rows;
+    ++m_Statistics.Batches;
+    m_Statistics.MeanBatchSize = static_cast<double>(m_Statistics.Requests)
+                               / static_cast<double>(m_Statistics.Batches);
+    m_Statistics.MaxBatchSize = std::max(m_Statistics.MaxBatchSize, rows);
+    if (m_Statistics.BatchSizeHistogram.size() <= rows) {
+        m_Statistics.BatchSizeHistogram.resize(m_MaxBatchSize + 1, 0);
+    }
+    ++m_Statistics.BatchSizeHistogram[rows];
+}
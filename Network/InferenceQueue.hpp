@@ -0,0 +1,178 @@
+//
+//  InferenceQueue.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】InferenceQueue.hpp
+//【功能模块和目的】异步推理队列类声明：把并发提交的单个请求合并为微批次，
+//       以批量推理的吞吐量服务在线请求，同时限制排队等待时间
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/18 先记录统计再兑现结果
+//------------------------------------------------------------------------------
+
+#ifndef InferenceQueue_hpp
+#define InferenceQueue_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::deque所属头文件
+#include <deque>
+//std::future、std::promise所属头文件
+#include <future>
+//std::thread所属头文件
+#include <thread>
+//std::mutex所属头文件
+#include <mutex>
+//std::condition_variable所属头文件
+#include <condition_variable>
+//std::chrono所属头文件
+#include <chrono>
+//Network类所属头文件
+#include "Network.hpp"
+
+//------------------------------------------------------------------------------
+//【类名】InferenceQueue
+//【功能】异步推理前端。调用者提交输入向量，立即得到std::future；
+//       后台调度线程在队列非空后等待，直到凑满MaxBatchSize个请求
+//       或最早的请求已等待MaxWait，再把至多MaxBatchSize个请求拼成行主序矩阵
+//       调用Network::InferenceBatch（使用网络的编译计划与线程数），逐个兑现结果。
+//       推理抛出的异常传给该批次的全部future。
+//       记录每个请求从提交到完成的延迟（最近LATENCY_WINDOW个）与批大小分布
+//【接口说明】
+//    以网络、最大批大小、最长等待时间为参数构造，启动调度线程
+//    禁止拷贝构造、赋值
+//    析构时处理完已提交的请求后停止调度线程
+//    提交请求，输入长度与输入神经元数不符时抛出std::invalid_argument
+//    获取、清零统计（延迟p50/p99、批次数、平均与最大批大小、批大小分布）
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+class InferenceQueue {
+public:
+    //--------------------------------------------------------------------------
+    //与数据交换相关的内嵌类
+    //--------------------------------------------------------------------------
+    // 队列统计
+    class Statistics {
+    public:
+        // 已完成的请求数
+        size_t Requests{0};
+        // 已执行的批次数
+        size_t Batches{0};
+        // 平均批大小
+        double MeanBatchSize{0.0};
+        // 最大批大小
+        size_t MaxBatchSize{0};
+        // 批大小分布，第k个元素为大小为k的批次数
+        std::vector<size_t> BatchSizeHistogram;
+        // 延迟中位数（微秒，统计最近LATENCY_WINDOW个请求）
+        double P50Latency{0.0};
+        // 延迟99分位数（微秒）
+        double P99Latency{0.0};
+        // 最大延迟（微秒）
+        double MaxLatency{0.0};
+    };
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 以网络、最大批大小（0视为1）、最长等待时间为参数构造，网络不合理时抛出std::runtime_error；
+    // 网络需在队列析构前保持有效，且运行期间不修改结构
+    explicit InferenceQueue(const Network& ANetwork,
+                            size_t MaxBatchSize = DEFAULT_MAX_BATCH_SIZE,
+                            std::chrono::microseconds MaxWait = DEFAULT_MAX_WAIT);
+    // 禁止拷贝构造
+    InferenceQueue(const InferenceQueue&) = delete;
+    // 禁止赋值
+    InferenceQueue& operator=(const InferenceQueue&) = delete;
+    // 虚析构函数，处理完已提交的请求后停止调度线程
+    virtual ~InferenceQueue();
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 提交一个请求，返回结果的future，可由多个线程并发调用
+    std::future<std::vector<double>> Submit(std::vector<double> input);
+    // 清零统计
+    void ResetStatistics();
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取统计
+    Statistics GetStatistics() const;
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 默认最大批大小
+    static constexpr size_t DEFAULT_MAX_BATCH_SIZE{32};
+    // 默认最长等待时间
+    static constexpr std::chrono::microseconds DEFAULT_MAX_WAIT{200};
+    // 延迟统计窗口（最近的请求数）
+    static constexpr size_t LATENCY_WINDOW{1 << 16};
+private:
+    //--------------------------------------------------------------------------
+    //私有内嵌类
+    //--------------------------------------------------------------------------
+    // 计时使用的时钟
+    using Clock = std::chrono::steady_clock;
+    // 排队中的请求
+    class Request {
+    public:
+        // 输入向量
+        std::vector<double> Input;
+        // 结果
+        std::promise<std::vector<double>> Result;
+        // 提交时刻
+        Clock::time_point Arrival;
+    };
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 调度线程主循环：凑批、推理、兑现结果，直至停止且队列为空
+    void DispatchLoop();
+    // 执行一个批次并记录统计
+    void RunBatch(std::vector<Request>& Batch);
+    // 记录一个批次的统计（需持有统计锁）
+    void RecordBatch(const std::vector<Request>& Batch, Clock::time_point Done);
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 推理使用的网络
+    const Network& m_Network;
+    // 最大批大小
+    size_t m_MaxBatchSize;
+    // 最长等待时间
+    std::chrono::microseconds m_MaxWait;
+    // 输入神经元数
+    size_t m_InputCount;
+    // 输出神经元数
+    size_t m_OutputCount;
+    // 待处理请求队列
+    std::deque<Request> m_Pending;
+    // 是否停止
+    bool m_Stop{false};
+    // 保护请求队列与停止标志
+    std::mutex m_Mutex;
+    // 新请求到达或停止时通知调度线程
+    std::condition_variable m_RequestReady;
+    // 批次输入矩阵，仅调度线程使用
+    std::vector<double> m_Input;
+    // 批次输出矩阵，仅调度线程使用
+    std::vector<double> m_Output;
+    // 最近请求的延迟（微秒），环形缓冲
+    std::vector<double> m_Latencies;
+    // 下一个延迟写入位置
+    size_t m_LatencyNext{0};
+    // 统计（不含延迟分位数）
+    Statistics m_Statistics;
+    // 保护延迟与统计
+    mutable std::mutex m_StatisticsMutex;
+    // 调度线程，最后构造以保证其他成员已初始化
+    std::thread m_Dispatcher;
+};
+//------------------------------------------------------------------------------
+
+#endif /* InferenceQueue_hpp */
@@ -0,0 +1,279 @@
+//
+//  InferenceSession.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】InferenceSession.cpp
+//【功能模块和目的】增量推理会话类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/18 被触及的神经元按树突重新计算加权和，避免增量累积误差与NaN残留
+//            2026/10/18 由NetworkGraph编号并转置得到轴突CSR
+//            2026/10/18 恢复加权和的增量更新，按神经元在非有限值、抵消或累计次数过多时重新求和
+//------------------------------------------------------------------------------
+
+// InferenceSession类所属头文件
+#include "InferenceSession.hpp"
+// Network类所属头文件
+#include "Network.hpp"
+// NetworkGraph类所属头文件
+#include "NetworkGraph.hpp"
+// 异常基类所属头文件
+#include <stdexcept>
+// std::max_element所属头文件
+#include <algorithm>
+// std::isfinite、std::fabs所属头文件
+#include <cmath>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：InferenceSession
+// 功能：由网络构造会话。由NetworkGraph按层级编号（输入神经元在前，即拓扑顺序）
+//       并复制偏置、激活类型与入边CSR，再转置得到出边CSR
+// 入口参数：const Network& ANetwork
+// 出口参数：无
+// 返回值：无
+InferenceSession::InferenceSession(const Network& ANetwork) {
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Network is not valid for inference");
+    }
+    // 1. 按层级编号，复制偏置、激活类型与树突CSR
+    const NetworkGraph graph(ANetwork);
+    const size_t count = graph.GetNeuronCount();
+    m_InputCount = graph.GetInputCount();
+    m_Level = graph.GetLevel();
+    m_Bias = graph.GetBias();
+    m_Activation = graph.GetActivation();
+    m_InStart = graph.GetRowStart();
+    m_InSource = graph.GetSource();
+    m_InWeight = graph.GetWeight();
+    m_InputIndex = graph.GetInputIndex();
+    m_OutputIndex = graph.GetOutputIndex();
+
+    // 2. 转置树突CSR得到轴突CSR（只保留指向非输入神经元的连接，输入神经元的值只由输入决定）
+    m_OutStart.assign(count + 1, 0);
+    for (size_t target = m_InputCount; target < count; ++target) {
+        for (size_t k = m_InStart[target]; k < m_InStart[target + 1]; ++k) {
+            ++m_OutStart[m_InSource[k] + 1];
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        m_OutStart[i + 1] += m_OutStart[i];
+    }
+    m_OutTarget.resize(m_OutStart[count]);
+    m_OutWeight.resize(m_OutStart[count]);
+    std::vector<size_t> position(m_OutStart.begin(), m_OutStart.end() - 1);
+    for (size_t target = m_InputCount; target < count; ++target) {
+        for (size_t k = m_InStart[target]; k < m_InStart[target + 1]; ++k) {
+            m_OutWeight[position[m_InSource[k]]] = m_InWeight[k];
+            m_OutTarget[position[m_InSource[k]]++] = static_cast<uint32_t>(target);
+        }
+    }
+
+    // 3. 分配会话状态
+    m_Value.assign(count, 0.0);
+    m_Sum.assign(count, 0.0);
+    m_DeltaCount.assign(count, 0);
+    m_Stale.assign(count, 0);
+    m_Queued.assign(count, 0);
+    m_Pending.resize(count > 0 ? *std::max_element(m_Level.begin(), m_Level.end()) + 1 : 0);
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Inference
+// 功能：执行推理。首次（或Reset后）完整计算；此后找出值变化的输入，
+//       沿轴突输出把"权重×输出变化量"累加到受影响神经元的加权和上，再按层级顺序
+//       对这些神经元以更新后的加权和重新计算激活值；输出不变的神经元不再向后传播。
+//       被标记为需要重新求和的神经元（见Propagate）改为按树突重新计算加权和。
+//       每次耗时与变化经过的突触数成正比
+// 入口参数：const std::vector<double>& input 输入值列表
+// 出口参数：无
+// 返回值：输出值列表的引用（在下次推理前有效），输入数量不匹配时为空列表
+const std::vector<double>& InferenceSession::Inference(const std::vector<double>& input) {
+    if (input.size() != m_InputIndex.size()) {
+        m_Outputs.clear();
+        return m_Outputs;
+    }
+    if (!m_Primed) {
+        FullPass(input);
+        return m_Outputs;
+    }
+    m_LastUpdateCount = 0;
+    m_LastSynapseCount = 0;
+    // 1. 输入神经元：输出为输入值加偏置，把变化量传给轴突目标
+    for (size_t i = 0; i < input.size(); ++i) {
+        if (input[i] == m_LastInput[i]) {
+            continue;
+        }
+        m_LastInput[i] = input[i];
+        const size_t idx = m_InputIndex[i];
+        const double old = m_Value[idx];
+        m_Value[idx] = input[i] + m_Bias[idx];
+        Propagate(idx, old, m_Value[idx]);
+    }
+    // 2. 按层级顺序处理受影响的神经元（目标总在更靠后的层级）
+    for (size_t level = 1; level < m_Pending.size(); ++level) {
+        for (uint32_t idx : m_Pending[level]) {
+            m_Queued[idx] = 0;
+            if (m_Stale[idx] || !std::isfinite(m_Sum[idx])) {
+                Resum(idx);
+            }
+            const double old = m_Value[idx];
+            const double value = ActivationFunction::Evaluate(m_Activation[idx], m_Sum[idx]);
+            m_Value[idx] = value;
+            ++m_LastUpdateCount;
+            // NaN与自身不等，仍会向后传播
+            if (value != old) {
+                Propagate(idx, old, value);
+            }
+        }
+        m_Pending[level].clear();
+    }
+    CollectOutputs();
+    return m_Outputs;
+}
+
+// 函数名：Reset
+// 功能：清除历史输出，下次推理完整计算
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceSession::Reset() {
+    m_Primed = false;
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：GetLastUpdateCount
+// 功能：获取上次推理重新计算的非输入神经元数量
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 神经元数量
+size_t InferenceSession::GetLastUpdateCount() const {
+    return m_LastUpdateCount;
+}
+
+// 函数名：GetLastSynapseCount
+// 功能：获取上次推理处理的突触数（增量传播经过的轴突与重新求和读取的树突合计）
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 突触数
+size_t InferenceSession::GetLastSynapseCount() const {
+    return m_LastSynapseCount;
+}
+
+// 函数名：GetNeuronCount
+// 功能：获取神经元总数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 神经元总数
+size_t InferenceSession::GetNeuronCount() const {
+    return m_Bias.size();
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：FullPass
+// 功能：完整计算全部神经元，并记录输入以供后续增量推理
+// 入口参数：const std::vector<double>& input 输入值列表
+// 出口参数：无
+// 返回值：无
+void InferenceSession::FullPass(const std::vector<double>& input) {
+    for (size_t i = 0; i < input.size(); ++i) {
+        m_Value[m_InputIndex[i]] = input[i] + m_Bias[m_InputIndex[i]];
+    }
+    m_LastSynapseCount = 0;
+    for (size_t idx = m_InputCount; idx < m_Bias.size(); ++idx) {
+        Resum(idx);
+        m_Value[idx] = ActivationFunction::Evaluate(m_Activation[idx], m_Sum[idx]);
+    }
+    m_LastUpdateCount = m_Bias.size() - m_InputCount;
+    m_LastInput = input;
+    m_Primed = true;
+    CollectOutputs();
+}
+
+// 函数名：WeightedSum
+// 功能：按树突计算神经元的加权和（含偏置）
+// 入口参数：size_t neuron 神经元编号
+// 出口参数：无
+// 返回值：double 加权和
+double InferenceSession::WeightedSum(size_t neuron) const {
+    double sum = m_Bias[neuron];
+    for (size_t k = m_InStart[neuron]; k < m_InStart[neuron + 1]; ++k) {
+        sum += m_InWeight[k] * m_Value[m_InSource[k]];
+    }
+    return sum;
+}
+
+// 函数名：Resum
+// 功能：按树突重新计算神经元的加权和，清除其增量计数与重新求和标记
+// 入口参数：size_t neuron 神经元编号
+// 出口参数：无
+// 返回值：无
+void InferenceSession::Resum(size_t neuron) {
+    m_Sum[neuron] = WeightedSum(neuron);
+    m_DeltaCount[neuron] = 0;
+    m_Stale[neuron] = 0;
+    m_LastSynapseCount += m_InStart[neuron + 1] - m_InStart[neuron];
+}
+
+// 函数名：Propagate
+// 功能：神经元输出由Old变为Value后，把权重×变化量累加到各轴突目标的加权和上，
+//       并把尚未排队的目标加入其层级的待处理列表。以下情况把目标标记为需要重新求和：
+//       新旧值有非有限值（变化量无意义）；变化量超过更新后加权和的CANCELLATION_RATIO倍
+//       （大数相消，舍入误差相对结果被放大）；目标累计增量更新达到RESUM_INTERVAL次
+// 入口参数：size_t neuron 神经元编号, double Old 原输出值, double Value 新输出值
+// 出口参数：无
+// 返回值：无
+void InferenceSession::Propagate(size_t neuron, double Old, double Value) {
+    const bool finite = std::isfinite(Old) && std::isfinite(Value);
+    const double delta = Value - Old;
+    m_LastSynapseCount += m_OutStart[neuron + 1] - m_OutStart[neuron];
+    for (size_t k = m_OutStart[neuron]; k < m_OutStart[neuron + 1]; ++k) {
+        const uint32_t target = m_OutTarget[k];
+        if (finite) {
+            const double change = m_OutWeight[k] * delta;
+            m_Sum[target] += change;
+            if (std::fabs(change) > CANCELLATION_RATIO * std::fabs(m_Sum[target])) {
+                m_Stale[target] = 1;
+            }
+        } else {
+            m_Stale[target] = 1;
+        }
+        if (++m_DeltaCount[target] >= RESUM_INTERVAL) {
+            m_Stale[target] = 1;
+        }
+        if (!m_Queued[target]) {
+            m_Queued[target] = 1;
+            m_Pending[m_Level[target]].push_back(target);
+        }
+    }
+}
+
+// 函数名：CollectOutputs
+// 功能：收集输出神经元的当前值
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void InferenceSession::CollectOutputs() {
+    m_Outputs.resize(m_OutputIndex.size());
+    for (size_t o = 0; o < m_OutputIndex.size(); ++o) {
+        m_Outputs[o] = m_Value[m_OutputIndex[o]];
+    }
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,151 @@
+//
+//  InferenceSession.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】InferenceSession.hpp
+//【功能模块和目的】增量推理会话类声明：保存上次推理的各神经元输出，
+//       输入部分变化时只沿轴突输出传播受影响的前向锥
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/18 被触及的神经元按树突重新计算加权和，不再累加增量
+//            2026/10/18 由NetworkGraph编号，出边CSR由入边CSR转置得到
+//            2026/10/18 恢复加权和的增量更新，按神经元控制误差与非有限值
+//------------------------------------------------------------------------------
+
+#ifndef InferenceSession_hpp
+#define InferenceSession_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//uint32_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::shared_ptr所属头文件
+#include <memory>
+//ActivationFunction类所属头文件
+#include "ActivationFunction.hpp"
+
+// 前向声明网络类，防止循环依赖
+class Network;
+
+//------------------------------------------------------------------------------
+//【类名】InferenceSession
+//【功能】有状态的增量推理会话。构造时把网络的拓扑结构、偏置、权重复制为
+//       连续数组（由NetworkGraph按层级编号，双向邻接），并保存每个神经元上一次的输出值。
+//       再次推理时只处理值发生变化的输入，沿轴突输出逐层级把"权重×变化量"
+//       累加到受影响神经元的加权和上，线性神经元输出即该和，非线性神经元只对该和
+//       重新计算激活值；输出未变的神经元不再向后传播，耗时与变化经过的突触数成正比。
+//       源值出现非有限值、大数相消或累计增量次数达到RESUM_INTERVAL的神经元
+//       改为按树突重新求和，舍入误差与NaN不会残留
+//【接口说明】
+//    以Network为参数构造，网络不合理时抛出异常
+//    拷贝构造函数、赋值运算符，默认实现
+//    执行（增量）推理
+//    清除历史，下次推理完整计算
+//    获取上次推理重新计算的神经元数量、处理的突触数、神经元总数
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】2026/10/18 增量更新的加权和m_Sum按神经元记录增量次数与重新求和标记
+//------------------------------------------------------------------------------
+class InferenceSession {
+public:
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 由网络构造会话，网络不合理时抛出std::runtime_error；
+    // 会话保存网络结构与参数的快照，网络修改后需重新构造
+    explicit InferenceSession(const Network& ANetwork);
+    // 拷贝构造函数，默认实现
+    InferenceSession(const InferenceSession& Source) = default;
+    // 赋值运算符重载，默认实现
+    InferenceSession& operator=(const InferenceSession& Source) = default;
+    // 虚析构函数，默认实现
+    virtual ~InferenceSession() = default;
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 执行推理：首次完整计算，此后只传播变化的输入；输入数量不匹配时返回空列表
+    const std::vector<double>& Inference(const std::vector<double>& input);
+    // 清除历史输出，下次推理完整计算
+    void Reset();
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取上次推理重新计算的非输入神经元数量
+    size_t GetLastUpdateCount() const;
+    // 获取上次推理处理的突触数（增量传播与重新求和合计）
+    size_t GetLastSynapseCount() const;
+    // 获取神经元总数
+    size_t GetNeuronCount() const;
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 神经元累计增量更新达到该次数后按树突重新求和，限制舍入误差累积
+    static constexpr uint32_t RESUM_INTERVAL{1024};
+    // 单次变化量超过更新后加权和的该倍数（大数相消）时按树突重新求和
+    static constexpr double CANCELLATION_RATIO{1e4};
+private:
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 按编号（拓扑）顺序完整计算全部神经元
+    void FullPass(const std::vector<double>& input);
+    // 按树突计算一个神经元的加权和（含偏置）
+    double WeightedSum(size_t neuron) const;
+    // 按树突重新计算加权和，清除增量计数与重新求和标记
+    void Resum(size_t neuron);
+    // 把输出变化量乘以权重累加到轴突目标的加权和上，并将目标加入待处理列表
+    void Propagate(size_t neuron, double Old, double Value);
+    // 收集输出神经元的值到m_Outputs
+    void CollectOutputs();
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 各神经元偏置，按层级顺序编号
+    std::vector<double> m_Bias;
+    // 各神经元激活函数类型码
+    std::vector<int> m_Activation;
+    // 各神经元的层级（最长路径深度）
+    std::vector<size_t> m_Level;
+    // 输入神经元数量，输入神经元占据编号[0, m_InputCount)
+    size_t m_InputCount{0};
+    // 树突CSR：第i个神经元的树突位于[m_InStart[i], m_InStart[i+1])
+    std::vector<size_t> m_InStart;
+    std::vector<uint32_t> m_InSource;
+    std::vector<double> m_InWeight;
+    // 轴突CSR：第i个神经元的轴突输出位于[m_OutStart[i], m_OutStart[i+1])
+    std::vector<size_t> m_OutStart;
+    std::vector<uint32_t> m_OutTarget;
+    std::vector<double> m_OutWeight;
+    // 输入、输出标记对应的神经元编号
+    std::vector<size_t> m_InputIndex;
+    std::vector<size_t> m_OutputIndex;
+    // 各神经元当前输出值
+    std::vector<double> m_Value;
+    // 各神经元当前的加权和（含偏置）
+    std::vector<double> m_Sum;
+    // 各神经元自上次重新求和以来的增量更新次数
+    std::vector<uint32_t> m_DeltaCount;
+    // 神经元是否需要按树突重新求和
+    std::vector<char> m_Stale;
+    // 上次推理的输入值
+    std::vector<double> m_LastInput;
+    // 神经元是否已在待处理列表中
+    std::vector<char> m_Queued;
+    // 按层级分组的待处理神经元
+    std::vector<std::vector<uint32_t>> m_Pending;
+    // 输出值列表
+    std::vector<double> m_Outputs;
+    // 是否已有可用的历史输出
+    bool m_Primed{false};
+    // 上次推理重新计算的神经元数量
+    size_t m_LastUpdateCount{0};
+    // 上次推理处理的突触数
+    size_t m_LastSynapseCount{0};
+};
+//------------------------------------------------------------------------------
+
+#endif /* InferenceSession_hpp */
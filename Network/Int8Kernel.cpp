@@ -0,0 +1,107 @@
+//
+//  Int8Kernel.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】Int8Kernel.cpp
+//【功能模块和目的】int8×int8→int32量化矩阵计算内核实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+// Int8Kernel类所属头文件
+#include "Int8Kernel.hpp"
+
+// 按编译目标选择向量路径：VNNI优先，其次AVX2，否则使用标量实现
+#if defined(__AVXVNNI__) || (defined(__AVX512VNNI__) && defined(__AVX512VL__))
+#define ANN_INT8_VNNI 1
+#endif
+#if defined(ANN_INT8_VNNI) || defined(__AVX2__)
+// x86向量指令内建函数所属头文件
+#include <immintrin.h>
+#endif
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：PaddedSize（静态）
+// 功能：获取cols补齐到ALIGN倍数后的长度
+// 入口参数：size_t cols
+// 出口参数：无
+// 返回值：size_t 补齐后的长度
+size_t Int8Kernel::PaddedSize(size_t cols) {
+    return (cols + ALIGN - 1) / ALIGN * ALIGN;
+}
+
+// 函数名：Dot（静态）
+// 功能：计算int8向量点积。向量路径先以sign指令把a的符号转移到b上，
+//       得到无符号|a|与有符号b·sgn(a)，再做u8×s8乘加，各乘积与原乘积相等
+// 入口参数：const int8_t* a, const int8_t* b, size_t n（ALIGN的倍数）
+// 出口参数：无
+// 返回值：int32_t 点积
+int32_t Int8Kernel::Dot(const int8_t* a, const int8_t* b, size_t n) {
+#if defined(ANN_INT8_VNNI)
+    __m256i acc = _mm256_setzero_si256();
+    for (size_t i = 0; i < n; i += ALIGN) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+#if defined(__AVXVNNI__)
+        acc = _mm256_dpbusd_avx_epi32(acc, _mm256_sign_epi8(va, va), _mm256_sign_epi8(vb, va));
+#else
+        acc = _mm256_dpbusd_epi32(acc, _mm256_sign_epi8(va, va), _mm256_sign_epi8(vb, va));
+#endif
+    }
+#elif defined(__AVX2__)
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i acc = _mm256_setzero_si256();
+    for (size_t i = 0; i < n; i += ALIGN) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        // |a|·|b| ≤ 127·127，成对和不超过32767，pmaddubsw不会饱和
+        __m256i pairs = _mm256_maddubs_epi16(_mm256_sign_epi8(va, va), _mm256_sign_epi8(vb, va));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(pairs, ones));
+    }
+#endif
+#if defined(ANN_INT8_VNNI) || defined(__AVX2__)
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    return _mm_cvtsi128_si32(sum);
+#else
+    int32_t sum{0};
+    for (size_t i = 0; i < n; ++i) {
+        sum += static_cast<int32_t>(a[i]) * static_cast<int32_t>(b[i]);
+    }
+    return sum;
+#endif
+}
+
+// 函数名：MatVec（静态）
+// 功能：int8矩阵-向量乘法，逐行计算点积
+// 入口参数：const int8_t* W, size_t rows, size_t padded 行长度, const int8_t* x
+// 出口参数：int32_t* y
+// 返回值：无
+void Int8Kernel::MatVec(const int8_t* W, size_t rows, size_t padded,
+                        const int8_t* x, int32_t* y) {
+    for (size_t r = 0; r < rows; ++r) {
+        y[r] = Dot(W + r * padded, x, padded);
+    }
+}
+
+// 函数名：GetPath（静态）
+// 功能：获取当前编译目标使用的指令集路径名称
+// 入口参数：无
+// 出口参数：无
+// 返回值：const char* 路径名称
+const char* Int8Kernel::GetPath() {
+#if defined(ANN_INT8_VNNI)
+    return "VNNI";
+#elif defined(__AVX2__)
+    return "AVX2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,58 @@
+//
+//  Int8Kernel.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】Int8Kernel.hpp
+//【功能模块和目的】int8×int8→int32量化矩阵计算内核声明
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef Int8Kernel_hpp
+#define Int8Kernel_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//int8_t、int32_t所属头文件
+#include <cstdint>
+
+//------------------------------------------------------------------------------
+//【类名】Int8Kernel
+//【功能】对称int8量化的矩阵-向量内核。权重按行主序存放，每行补零到ALIGN的倍数；
+//       取值限定在[-127, 127]，使|x|·(w·sgn x)的成对和不超过int16范围，
+//       AVX2下以pmaddubsw无饱和地计算，支持VNNI时以vpdpbusd计算，否则为标量实现
+//【接口说明】
+//    静态：获取补齐后的行长度
+//    静态：int8向量点积
+//    静态：int8矩阵-向量乘法，结果为int32
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+class Int8Kernel {
+public:
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 行长度对齐单位（一个256位向量中的int8个数）
+    static constexpr size_t ALIGN{32};
+    // 量化值的最大绝对值
+    static constexpr int LIMIT{127};
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    // 获取cols补齐到ALIGN倍数后的长度
+    static size_t PaddedSize(size_t cols);
+    // 计算a、b前n个元素的点积，n须为ALIGN的倍数
+    static int32_t Dot(const int8_t* a, const int8_t* b, size_t n);
+    // y[r] = Σc W[r][c] × x[c]，W为rows行、行长度padded的行主序矩阵
+    static void MatVec(const int8_t* W, size_t rows, size_t padded,
+                       const int8_t* x, int32_t* y);
+    // 当前编译目标使用的指令集路径名称（"VNNI"、"AVX2"或"scalar"）
+    static const char* GetPath();
+};
+//------------------------------------------------------------------------------
+
+#endif /* Int8Kernel_hpp */
@@ -23,6 +23,8 @@
 #include <memory>
 // std::cout所属头文件
 #include <iostream>
+// std::atomic所属头文件
+#include <atomic>
 
 // 函数名:Layer
 // 功能:含参构造函数，初始化层索引(全局唯一索引)
@@ -43,6 +45,7 @@ void Layer::AddNeuron(std::shared_ptr<Neuron> neuron){
         // 设置神经元所属层指针，存储于Neuron成员变量中
         neuron->SetLayer(shared_from_this());
         m_Neurons.push_back(neuron);
+        Touch();
     }
 }
 
@@ -89,6 +92,7 @@ void Layer::RemoveNeuron(size_t NeuronIndex) {
         // 从层中移除神经元并重置其层指针
         NeuronToRemove->SetLayer(nullptr);
         m_Neurons.erase(it);
+        Touch();
     }
 }
 
@@ -132,6 +136,9 @@ bool Layer::ConnectNeurons(std::shared_ptr<Neuron> source,
     target->AddDendrite(synapse);
     // 添加到源神经元的轴突输出中
     source->AddAxonOutput(synapse);
+    // 两端所属层的结构均发生变化
+    sourceLayer->Touch();
+    targetLayer->Touch();
     return true;
 }
 
@@ -225,3 +232,32 @@ void Layer::Clear() {
         RemoveNeuron(index);
     }
 }
+
+// 函数名:GetGeneration
+// 功能:获取层的结构版本号
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t，结构版本号
+size_t Layer::GetGeneration() const {
+    return m_Generation;
+}
+
+// 函数名:Touch
+// 功能:标记层结构已变化，从全局时钟取得新的结构版本号
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void Layer::Touch() {
+    m_Generation = NextGeneration();
+}
+
+// 函数名:NextGeneration（静态）
+// 功能:从全局时钟获取新的结构版本号。全局单调递增，
+//      使Network可用"取最大值"的方式汇总各层版本号
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t，新的结构版本号（从1开始，0表示从未验证）
+size_t Layer::NextGeneration() {
+    static std::atomic<size_t> s_Clock{0};
+    return ++s_Clock;
+}
@@ -46,8 +46,10 @@ class Network;
 //    列出层中所有神经元信息（编号和偏置）
 //    获取所有神经元
 //    清空层（删除所有神经元和连接）
+//    获取、刷新层的结构版本号
+//    静态：从全局时钟获取新的结构版本号
 //【开发者及日期】 孙李智 2025/7/14
-//【更改记录】
+//【更改记录】 2026/10/17 增加结构版本号，供Network缓存验证结果
 //------------------------------------------------------------------------------
 class Layer : public std::enable_shared_from_this<Layer> {
 public:
@@ -79,6 +81,12 @@ public:
     const std::vector<std::shared_ptr<Neuron>>& GetNeurons() const;
     // 清空层（删除所有神经元和连接）
     void Clear();
+    // 获取层的结构版本号，层内神经元或连接变化后增大
+    size_t GetGeneration() const;
+    // 标记层结构已变化，刷新结构版本号
+    void Touch();
+    // 从全局时钟获取新的结构版本号，单调递增且从1开始
+    static size_t NextGeneration();
 private:
     //------------------------------------------------------------------------
     // 私有成员函数
@@ -87,6 +95,8 @@ private:
     size_t m_LayerIndex;
     // 层神经元集合，vector容器存储
     std::vector<std::shared_ptr<Neuron>> m_Neurons;
+    // 层的结构版本号
+    size_t m_Generation{NextGeneration()};
 };
 
 #endif /* Layer.hpp */
\ No newline at end of file
@@ -9,6 +9,9 @@
 //【功能描述】    实现神经网络的结构管理、模型导入导出、验证推理等功能
 //【开发者及日期】孙李智 2025-07-15
 //【更改记录】
+//            2026/10/17 推理前查找结果缓存
+//            2026/10/18 编译计划使用网络设置的激活近似方式
+//            2026/10/18 增加只计算部分输出的推理
 //---------------------------------------------------------------------
 
 // Network类所属头文件
@@ -29,6 +32,10 @@
 #include <queue>      
 // std::unordered_set所需头文件
 #include<unordered_set>
+// std::max所需头文件
+#include <algorithm>
+// ThreadPool类所需头文件
+#include "ThreadPool.hpp"
 
 // 函数名：operator=
 // 功能：赋值运算符重载
@@ -129,7 +136,12 @@ Network& Network::operator=(const Network& other){
     // 复制输入/输出连接
     inputConnections = other.inputConnections;
     outputConnections = other.outputConnections;
+    m_ThreadCount = other.m_ThreadCount;
+    m_Approximation = other.m_Approximation;
+    m_pPool = other.m_pPool;
+    m_Cache = InferenceCache(other.m_Cache.GetCapacity());
 
+    Touch();
     return *this;
 }
 
@@ -142,6 +154,7 @@ Network& Network::operator=(const Network& other){
 bool Network::AddLayer(size_t LayerIndex) {
     auto newLayer = std::make_shared<Layer>(LayerIndex);
     m_Layers.push_back(newLayer);
+    Touch();
     return true;
 }
 
@@ -162,6 +175,7 @@ bool Network::RemoveLayer(size_t LayerIndex){
             (*it)->Clear();
             // 从 m_Layers 容器中移除该 Layer 对象
             m_Layers.erase(it);
+            Touch();
             // 返回 true 表示删除成功
             return true; 
         }
@@ -184,6 +198,7 @@ bool Network::RemoveAllLayer(){
     }
     // 清空层列表
     m_Layers.clear();
+    Touch();
     return true;
 }
 
@@ -211,6 +226,7 @@ bool Network::RemoveNeuron(size_t NeuronIndex){
             if (neuronToFind) {
                 // 若找到该神经元，则调用层的 RemoveNeuron 方法删除它
                 layer->RemoveNeuron(NeuronIndex);
+                Touch();
                 return true;
             }
         }
@@ -233,6 +249,8 @@ bool Network::ModifyNeuronBias(size_t NeuronIndex, double Bias){
             if (neuronToFind) {
                 // 若找到该神经元，则修改其偏置
                 neuronToFind->SetBias(Bias);
+                // 偏置已冻结在编译计划中，需刷新版本号
+                Touch();
                 return true;
             }
         }
@@ -267,6 +285,7 @@ void Network::AddOutputConnection(size_t sourceIdx, double weight) {
 void Network::SetInputMarker(std::shared_ptr<Neuron> marker) {
     if (marker) {
         inputMarkers.push_back(marker);
+        Touch();
     }
 }
 
@@ -278,6 +297,7 @@ void Network::SetInputMarker(std::shared_ptr<Neuron> marker) {
 void Network::SetOutputMarker(std::shared_ptr<Neuron> marker) {
     if (marker) {
         outputMarker.push_back(marker);
+        Touch();
     }
 }
     
@@ -300,11 +320,100 @@ std::vector<std::shared_ptr<Neuron>> Network::GetOutputMarker() const {
 }
 
 // 函数名：IsVaild
-// 功能：判断网络是否合理
+// 功能：判断网络是否合理，结构版本号未变化时直接返回缓存结果
 // 入口参数：无
 // 出口参数：无
 // 返回值：合理则返回true
 bool Network::IsValid() const {
+    std::lock_guard<std::recursive_mutex> lock(m_CacheMutex.Mutex);
+    size_t generation = GetGeneration();
+    if (m_ValidatedGeneration != generation) {
+        m_TopologicalOrder.clear();
+        m_CachedValid = Validate(m_TopologicalOrder);
+        if (!m_CachedValid) {
+            m_TopologicalOrder.clear();
+        }
+        BuildWavefronts();
+        m_ValidatedGeneration = generation;
+    }
+    return m_CachedValid;
+}
+
+// 函数名：GetGeneration
+// 功能：获取结构版本号，取网络自身与各层版本号的最大值
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 结构版本号
+size_t Network::GetGeneration() const {
+    size_t generation = m_Generation;
+    for (const auto& layer : m_Layers) {
+        generation = std::max(generation, layer->GetGeneration());
+    }
+    return generation;
+}
+
+// 函数名：Touch
+// 功能：标记网络结构已变化，使缓存的验证结果失效
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void Network::Touch() {
+    m_Generation = Layer::NextGeneration();
+}
+
+// 函数名：GetTopologicalOrder
+// 功能：获取神经元拓扑顺序（按结构版本号缓存）
+// 入口参数：无
+// 出口参数：无
+// 返回值：拓扑顺序神经元列表，网络不合理时为空
+const std::vector<std::shared_ptr<Neuron>>& Network::GetTopologicalOrder() const {
+    std::lock_guard<std::recursive_mutex> lock(m_CacheMutex.Mutex);
+    IsValid();
+    return m_TopologicalOrder;
+}
+
+// 函数名：GetWavefronts
+// 功能：获取波前划分（按结构版本号缓存）
+// 入口参数：无
+// 出口参数：无
+// 返回值：波前列表，网络不合理时为空
+const std::vector<std::vector<std::shared_ptr<Neuron>>>& Network::GetWavefronts() const {
+    std::lock_guard<std::recursive_mutex> lock(m_CacheMutex.Mutex);
+    IsValid();
+    return m_Wavefronts;
+}
+
+// 函数名：BuildWavefronts
+// 功能：沿拓扑顺序求每个神经元的最长输入路径长度，按长度分组得到波前。
+//       同一波前内的神经元之间不存在连接，其源神经元都位于更早的波前
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void Network::BuildWavefronts() const {
+    m_Wavefronts.clear();
+    std::unordered_map<const Neuron*, size_t> level;
+    for (const auto& neuron : m_TopologicalOrder) {
+        size_t depth{0};
+        for (const auto& dendrite : neuron->GetDendrites()) {
+            auto it = level.find(dendrite->GetSource().get());
+            if (it != level.end()) {
+                depth = std::max(depth, it->second + 1);
+            }
+        }
+        level[neuron.get()] = depth;
+        if (depth >= m_Wavefronts.size()) {
+            m_Wavefronts.resize(depth + 1);
+        }
+        m_Wavefronts[depth].push_back(neuron);
+    }
+}
+
+// 函数名：Validate
+// 功能：实际执行合理性验证，同时求出拓扑顺序
+// 入口参数：无
+// 出口参数：std::vector<std::shared_ptr<Neuron>>& order 拓扑顺序
+// 返回值：合理则返回true
+bool Network::Validate(std::vector<std::shared_ptr<Neuron>>& order) const {
     // 检查网络基本结构
     if (m_Layers.empty()) return false;
     if (inputMarkers.empty()) return false; // 必须有输入神经元
@@ -367,6 +476,7 @@ bool Network::IsValid() const {
         auto current = q.front();
         q.pop();
         processedCount++;
+        order.push_back(current);
         if (graph.find(current) != graph.end()) {
             for (const auto& next : graph[current]) {
                 if (--inDegree[next] == 0) {
@@ -403,26 +513,35 @@ std::vector<double> Network::Inference(const std::vector<double>& input) {
     if (input.size() != inputMarkers.size()) {
         return {}; // 输入不匹配
     }
+    // 启用缓存时，相同输入且结构版本号未变则直接返回缓存结果
+    // （此时不更新各神经元的输出值）
+    const size_t generation = m_Cache.GetCapacity() > 0 ? GetGeneration() : 0;
+    if (const std::vector<double>* cached = m_Cache.Find(input, generation)) {
+        return *cached;
+    }
     // 2. 为每个输入神经元设置输入值（关键步骤）
     for (size_t i = 0; i < inputMarkers.size(); ++i) {
         inputMarkers[i]->InputMarkSetOutput(input[i]); // 输入值+偏置
     }
-    // 3. 执行前向传播（仅对非输入层的神经元计算）
-    // 3.1 收集输入层的索引（包含输入神经元的层）
-    std::unordered_set<size_t> inputLayerIndices;
-    for (const auto& inputNeuron : inputMarkers) {
-        if (auto layer = inputNeuron->GetLayer()) {
-            inputLayerIndices.insert(layer->GetIndex());
-        }
-    }
-    // 3.2 遍历层，跳过输入层
-    for (const auto& layer : m_Layers) {
-        if (inputLayerIndices.count(layer->GetIndex())) {
-            continue; // 跳过输入层，保留其输出
-        }
-        // 对非输入层的神经元执行前向传播
-        for (const auto& neuron : layer->GetNeurons()) {
-            neuron->Forward(); 
+    // 3. 按波前顺序执行前向传播（第0个波前为输入神经元，已设置输出）
+    //    源神经元均位于更早的波前，跳跃连接与乱序添加的层也能读到本次的输出；
+    //    同一波前内的神经元只写各自的输出，较大的波前可分块并行
+    const auto& wavefronts = GetWavefronts();
+    for (size_t w = 1; w < wavefronts.size(); ++w) {
+        const auto& front = wavefronts[w];
+        if (m_pPool && front.size() >= PARALLEL_WAVEFRONT) {
+            const size_t chunks = m_pPool->GetThreadCount();
+            const size_t chunk = (front.size() + chunks - 1) / chunks;
+            m_pPool->ParallelFor(chunks, [&front, chunk](size_t index) {
+                const size_t end = std::min(front.size(), (index + 1) * chunk);
+                for (size_t i = index * chunk; i < end; ++i) {
+                    front[i]->Forward();
+                }
+            });
+        } else {
+            for (const auto& neuron : front) {
+                neuron->Forward();
+            }
         }
     }
     // 4. 收集输出神经元的结果
@@ -430,10 +549,171 @@ std::vector<double> Network::Inference(const std::vector<double>& input) {
     for (const auto& outputNeuron : outputMarker) {
         outputs.push_back(outputNeuron->GetOutput());
     }
+    m_Cache.Insert(input, outputs, generation);
     return outputs;
 }
 
+// 函数名：Compile
+// 功能：将对象图编译为扁平推理计划
+// 入口参数：CompiledNetwork::PRECISION Precision 计划内部的计算精度
+// 出口参数：无
+// 返回值：CompiledNetwork，使用网络设置的激活近似方式，网络不合理时抛出std::runtime_error
+CompiledNetwork Network::Compile(CompiledNetwork::PRECISION Precision) const {
+    return CompiledNetwork(*this, Precision, m_Approximation);
+}
 
+// 函数名：InferenceBatch
+// 功能：使用缓存的编译计划对一批样本执行推理
+// 入口参数：const double* in 行主序输入矩阵，size_t batch 样本数
+// 出口参数：double* out 行主序输出矩阵
+// 返回值：无，网络不合理时抛出std::runtime_error
+void Network::InferenceBatch(const double* in, size_t batch, double* out) const {
+    GetPlan()->InferenceBatch(in, batch, out);
+}
+
+// 函数名：Inference
+// 功能：可重入推理。使用缓存的编译计划，中间结果写入调用者持有的上下文，
+//       不修改任何神经元；网络结构不变时多个线程可各用一个上下文并发调用
+// 入口参数：const std::vector<double>& input 输入值列表
+// 出口参数：CompiledNetwork::InferenceContext& context 推理上下文
+// 返回值：context.Outputs的引用，网络不合理时抛出std::runtime_error
+const std::vector<double>& Network::Inference(const std::vector<double>& input,
+                                              CompiledNetwork::InferenceContext& context) const {
+    // 持有计划的共享指针，期间计划即使被替换也保持有效
+    std::shared_ptr<const CompiledNetwork> plan = GetPlan();
+    return plan->Inference(input, context);
+}
+
+// 函数名：InferenceSubset
+// 功能：只计算部分输出。使用按输出序号列表缓存的反向锥编译计划，
+//       与其余输出无关的神经元不参与计算；不修改任何神经元，可多线程并发调用
+// 入口参数：const std::vector<double>& input 输入值列表,
+//           const std::vector<size_t>& OutputIndices 输出序号列表
+// 出口参数：无
+// 返回值：按OutputIndices顺序排列的输出值，输入数量不符时为空；
+//         网络不合理时抛出std::runtime_error，序号越界时抛出std::out_of_range
+std::vector<double> Network::InferenceSubset(const std::vector<double>& input,
+                                             const std::vector<size_t>& OutputIndices) const {
+    std::shared_ptr<const CompiledNetwork> plan = GetSubsetPlan(OutputIndices);
+    return plan->Inference(input);
+}
+
+// 函数名：GetThreadCount
+// 功能：获取批量推理线程数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 线程数（含调用线程）
+size_t Network::GetThreadCount() const {
+    return m_ThreadCount;
+}
+
+// 函数名：SetThreadCount
+// 功能：设置推理线程数，重建线程池并丢弃缓存的编译计划，
+//       下次批量推理时编译计划与网络共享新的线程池
+// 入口参数：size_t ThreadCount 线程数（含调用线程），0视为1
+// 出口参数：无
+// 返回值：无
+void Network::SetThreadCount(size_t ThreadCount) {
+    ThreadCount = std::max<size_t>(ThreadCount, 1);
+    std::lock_guard<std::recursive_mutex> lock(m_CacheMutex.Mutex);
+    if (ThreadCount != m_ThreadCount) {
+        m_ThreadCount = ThreadCount;
+        m_pPool = ThreadCount > 1 ? std::make_shared<ThreadPool>(ThreadCount) : nullptr;
+        m_pPlan.reset();
+    }
+}
+
+// 函数名：GetActivationApproximation
+// 功能：获取编译计划中Sigmoid、Tanh的近似方式
+// 入口参数：无
+// 出口参数：无
+// 返回值：ActivationFunction::APPROXIMATION 近似方式
+ActivationFunction::APPROXIMATION Network::GetActivationApproximation() const {
+    return m_Approximation;
+}
+
+// 函数名：SetActivationApproximation
+// 功能：设置编译计划中Sigmoid、Tanh的近似方式，方式改变时丢弃缓存的编译计划；
+//       逐神经元推理（Inference的非上下文版本）始终精确计算
+// 入口参数：ActivationFunction::APPROXIMATION Approximation 近似方式
+// 出口参数：无
+// 返回值：无
+void Network::SetActivationApproximation(ActivationFunction::APPROXIMATION Approximation) {
+    std::lock_guard<std::recursive_mutex> lock(m_CacheMutex.Mutex);
+    if (Approximation != m_Approximation) {
+        m_Approximation = Approximation;
+        m_pPlan.reset();
+        m_SubsetPlans.clear();
+    }
+}
+
+// 函数名：SetCacheCapacity
+// 功能：设置推理结果缓存容量，缩小时淘汰最久未使用的记录
+// 入口参数：size_t Capacity 记录数，0表示关闭缓存
+// 出口参数：无
+// 返回值：无
+void Network::SetCacheCapacity(size_t Capacity) {
+    m_Cache.SetCapacity(Capacity);
+}
+
+// 函数名：GetCacheStatistics
+// 功能：获取推理结果缓存统计
+// 入口参数：无
+// 出口参数：无
+// 返回值：InferenceCache::Statistics 命中、未命中、淘汰、失效次数及记录数
+InferenceCache::Statistics Network::GetCacheStatistics() const {
+    return m_Cache.GetStatistics();
+}
+
+// 函数名：GetPlan
+// 功能：获取与当前结构版本号一致的编译计划，版本号变化时重新编译
+// 入口参数：无
+// 出口参数：无
+// 返回值：编译计划指针，网络不合理时抛出std::runtime_error
+std::shared_ptr<const CompiledNetwork> Network::GetPlan() const {
+    std::lock_guard<std::recursive_mutex> lock(m_CacheMutex.Mutex);
+    size_t generation = GetGeneration();
+    if (!m_pPlan || m_PlanGeneration != generation) {
+        if (!IsValid()) {
+            throw std::runtime_error("Network is not valid for inference");
+        }
+        auto plan = std::make_shared<CompiledNetwork>(*this, CompiledNetwork::PRECISION::DOUBLE,
+                                                      m_Approximation);
+        plan->SetThreadPool(m_pPool);
+        m_pPlan = plan;
+        m_PlanGeneration = generation;
+    }
+    return m_pPlan;
+}
+
+// 函数名：GetSubsetPlan
+// 功能：获取指定输出的反向锥编译计划。结构版本号变化时清空缓存，
+//       缓存数量达到SUBSET_PLAN_CAPACITY时清空后重建
+// 入口参数：const std::vector<size_t>& OutputIndices 输出序号列表
+// 出口参数：无
+// 返回值：编译计划指针，网络不合理时抛出std::runtime_error，序号越界时抛出std::out_of_range
+std::shared_ptr<const CompiledNetwork> Network::GetSubsetPlan(
+    const std::vector<size_t>& OutputIndices) const {
+    std::lock_guard<std::recursive_mutex> lock(m_CacheMutex.Mutex);
+    size_t generation = GetGeneration();
+    if (m_SubsetPlanGeneration != generation) {
+        m_SubsetPlans.clear();
+        m_SubsetPlanGeneration = generation;
+    }
+    auto found = m_SubsetPlans.find(OutputIndices);
+    if (found != m_SubsetPlans.end()) {
+        return found->second;
+    }
+    if (!IsValid()) {
+        throw std::runtime_error("Network is not valid for inference");
+    }
+    auto plan = std::make_shared<const CompiledNetwork>(*this, OutputIndices, m_Approximation);
+    if (m_SubsetPlans.size() >= SUBSET_PLAN_CAPACITY) {
+        m_SubsetPlans.clear();
+    }
+    m_SubsetPlans.emplace(OutputIndices, plan);
+    return plan;
+}
 
 
 
@@ -445,5 +725,6 @@ std::vector<double> Network::Inference(const std::vector<double>& input) {
 void Network::AddLayer(std::shared_ptr<Layer> layer){
     if (layer) {
         m_Layers.push_back(layer);
+        Touch();
     }
 }
\ No newline at end of file
@@ -10,6 +10,9 @@
 //【功能描述】    实现神经网络的创建、修改、验证和推理功能
 //【开发者及日期】孙李智 2025-07-15
 //【更改记录】
+//            2026/10/17 增加推理结果LRU缓存
+//            2026/10/18 增加编译计划的Sigmoid、Tanh近似方式设置
+//            2026/10/18 增加只计算部分输出的推理
 //------------------------------------------------------------------------------
 
 #ifndef Network_hpp
@@ -33,6 +36,14 @@
 #include <stdexcept>
 // StringList所需头文件
 #include"StringList.hpp"
+// CompiledNetwork类所需头文件
+#include "CompiledNetwork.hpp"
+//std::recursive_mutex所需头文件
+#include <mutex>
+// InferenceCache类所需头文件
+#include "InferenceCache.hpp"
+// std::map所需头文件
+#include <map>
 
 //------------------------------------------------------------------------------
 //【类名】Network
@@ -54,6 +65,16 @@
 //    设置输出神经元
 //    获取输入神经元列表
 //    获取输出神经元列表
+//    编译为扁平推理计划
+//    获取、刷新结构版本号
+//    获取拓扑顺序与波前划分（按结构版本号缓存）
+//    批量推理（按结构版本号缓存编译计划）
+//    只计算部分输出的推理（按输出序号列表缓存只含其反向锥的编译计划）
+//    设置、获取批量推理线程数
+//    设置、获取编译计划中Sigmoid、Tanh的近似方式（逐神经元推理不受影响）
+//    使用推理上下文的可重入推理（缓存由互斥量保护，结构不变时可多线程共享）
+//    推理按拓扑波前顺序执行，支持跳跃连接与任意层顺序的有向无环图
+//    可选的推理结果LRU缓存（结构、偏置变化后自动失效），获取命中统计
 //【开发者及日期】 孙李智 2025/7/14
 //------------------------------------------------------------------------------
 class Network {
@@ -92,11 +113,76 @@ public:
     std::vector<std::shared_ptr<Neuron>> GetInputMarker() const;
     // 获取输出神经元列表
     std::vector<std::shared_ptr<Neuron>> GetOutputMarker() const;
-    // 判断是否合理
+    // 判断是否合理，结果按结构版本号缓存
     bool IsValid() const;
-    // 获取输出值列表
+    // 获取结构版本号，网络或任一层结构变化后增大
+    size_t GetGeneration() const;
+    // 标记网络结构已变化（直接操作神经元连接后需调用）
+    void Touch();
+    // 获取神经元拓扑顺序，网络不合理时返回空列表
+    const std::vector<std::shared_ptr<Neuron>>& GetTopologicalOrder() const;
+    // 获取波前划分：第k个波前为最长输入路径长度为k的神经元，同一波前内互不依赖；
+    // 第0个波前为输入神经元，网络不合理时返回空列表
+    const std::vector<std::vector<std::shared_ptr<Neuron>>>& GetWavefronts() const;
+    // 获取输出值列表，按波前顺序计算（中间结果写入神经元，不可并发调用）
     std::vector<double> Inference(const std::vector<double>& input);
+    // 可重入推理：中间结果写入调用者持有的上下文，多个线程可共享同一网络并发调用
+    const std::vector<double>& Inference(const std::vector<double>& input,
+                                         CompiledNetwork::InferenceContext& context) const;
+    // 只计算OutputIndices所指的输出（输出标记序号），返回值按该顺序排列；
+    // 只执行这些输出反向锥内的神经元，序号越界时抛出std::out_of_range
+    std::vector<double> InferenceSubset(const std::vector<double>& input,
+                                        const std::vector<size_t>& OutputIndices) const;
+    // 编译为扁平推理计划，可选float计算精度
+    // 使用网络设置的激活近似方式
+    CompiledNetwork Compile(
+        CompiledNetwork::PRECISION Precision = CompiledNetwork::PRECISION::DOUBLE) const;
+    // 批量推理，in为batch行×输入数的行主序矩阵，out为batch行×输出数的行主序矩阵
+    void InferenceBatch(const double* in, size_t batch, double* out) const;
+    // 获取批量推理线程数
+    size_t GetThreadCount() const;
+    // 设置推理线程数（含调用线程），作用于批量推理与大波前的并行计算
+    void SetThreadCount(size_t ThreadCount);
+    // 获取编译计划中Sigmoid、Tanh的近似方式
+    ActivationFunction::APPROXIMATION GetActivationApproximation() const;
+    // 设置编译计划中Sigmoid、Tanh的近似方式，作用于批量推理、可重入推理及由网络构造的执行器
+    void SetActivationApproximation(ActivationFunction::APPROXIMATION Approximation);
+    // 设置推理结果缓存容量（记录数），0表示关闭缓存（默认）
+    void SetCacheCapacity(size_t Capacity);
+    // 获取推理结果缓存统计
+    InferenceCache::Statistics GetCacheStatistics() const;
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 波前内神经元数不少于此值且线程数大于1时，波前内并行计算
+    static constexpr size_t PARALLEL_WAVEFRONT{256};
+    // 部分输出编译计划的缓存数量上限，超过时清空重建
+    static constexpr size_t SUBSET_PLAN_CAPACITY{64};
 private:
+    // --------------------------------------------------------------------------
+    // 私有成员函数
+    // --------------------------------------------------------------------------
+    // 实际执行合理性验证，同时求出拓扑顺序
+    bool Validate(std::vector<std::shared_ptr<Neuron>>& order) const;
+    // 由拓扑顺序计算波前划分
+    void BuildWavefronts() const;
+    // 获取与当前结构版本号一致的编译计划，必要时重新编译
+    std::shared_ptr<const CompiledNetwork> GetPlan() const;
+    // 获取指定输出的反向锥编译计划，结构版本号变化时清空缓存
+    std::shared_ptr<const CompiledNetwork> GetSubsetPlan(
+        const std::vector<size_t>& OutputIndices) const;
+    // --------------------------------------------------------------------------
+    // 私有内嵌类
+    // --------------------------------------------------------------------------
+    // 缓存互斥量：拷贝网络时不复制锁状态，每个网络对象持有独立的互斥量
+    class CacheMutex {
+    public:
+        CacheMutex() = default;
+        CacheMutex(const CacheMutex&) : Mutex() {}
+        CacheMutex& operator=(const CacheMutex&) { return *this; }
+        // 递归互斥量：编译计划时会再次调用IsValid、GetTopologicalOrder
+        std::recursive_mutex Mutex;
+    };
     // --------------------------------------------------------------------------
     // 私有数据成员
     // --------------------------------------------------------------------------
@@ -114,6 +200,34 @@ private:
     size_t m_Network_Index;
     // 神经网络输出值列表
     std::vector<double> output;
+    // 网络自身的结构版本号（层列表、输入输出标记变化时刷新）
+    size_t m_Generation{Layer::NextGeneration()};
+    // 验证结果对应的结构版本号，0表示尚未验证
+    mutable size_t m_ValidatedGeneration{0};
+    // 缓存的验证结果
+    mutable bool m_CachedValid{false};
+    // 缓存的神经元拓扑顺序
+    mutable std::vector<std::shared_ptr<Neuron>> m_TopologicalOrder;
+    // 缓存的波前划分
+    mutable std::vector<std::vector<std::shared_ptr<Neuron>>> m_Wavefronts;
+    // 缓存的编译计划
+    mutable std::shared_ptr<const CompiledNetwork> m_pPlan;
+    // 编译计划对应的结构版本号
+    mutable size_t m_PlanGeneration{0};
+    // 缓存的部分输出编译计划，以输出序号列表为键
+    mutable std::map<std::vector<size_t>, std::shared_ptr<const CompiledNetwork>> m_SubsetPlans;
+    // 部分输出编译计划对应的结构版本号
+    mutable size_t m_SubsetPlanGeneration{0};
+    // 批量推理线程数
+    size_t m_ThreadCount{1};
+    // 编译计划中Sigmoid、Tanh的近似方式
+    ActivationFunction::APPROXIMATION m_Approximation{ActivationFunction::APPROXIMATION::ACCURATE};
+    // 线程池，与编译计划共享，单线程时为空
+    std::shared_ptr<ThreadPool> m_pPool;
+    // 推理结果缓存，按结构版本号失效
+    InferenceCache m_Cache;
+    // 保护验证结果、拓扑顺序与编译计划缓存
+    mutable CacheMutex m_CacheMutex;
 };
 
 #endif /* Network_hpp */
\ No newline at end of file
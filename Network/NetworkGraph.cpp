@@ -0,0 +1,282 @@
+//
+//  NetworkGraph.cpp
+//
+//  Created by 孙李智 on 2026/10/18.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】NetworkGraph.cpp
+//【功能模块和目的】网络扁平化图类实现
+//【开发者及日期】孙李智 2026/10/18
+//【更改记录】
+//------------------------------------------------------------------------------
+
+// NetworkGraph类所属头文件
+#include "NetworkGraph.hpp"
+// Network类所属头文件
+#include "Network.hpp"
+// Neuron类所属头文件
+#include "Neuron.hpp"
+// Synapse类所属头文件
+#include "Synapse.hpp"
+// 异常基类所属头文件
+#include <stdexcept>
+// std::numeric_limits所属头文件
+#include <limits>
+// std::stable_sort、std::max所属头文件
+#include <algorithm>
+// 哈希映射头文件，用于存储神经元到收集编号的映射
+#include <unordered_map>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：NetworkGraph
+// 功能：由网络构造扁平化图。OutputIndices为空指针时收集整个网络（层内神经元在前，
+//       标记神经元补充在后）；否则只收集从指定输出沿树突反向可达的神经元
+//       与全部输入神经元，输出按指定顺序排列
+// 入口参数：const Network& ANetwork, const std::vector<size_t>* OutputIndices 输出序号或nullptr
+// 出口参数：无
+// 返回值：无，神经元数超出32位索引范围时抛出std::runtime_error
+NetworkGraph::NetworkGraph(const Network& ANetwork, const std::vector<size_t>* OutputIndices) {
+    const auto inputMarkers = ANetwork.GetInputMarker();
+    std::vector<std::shared_ptr<Neuron>> outputMarkers = ANetwork.GetOutputMarker();
+    if (OutputIndices != nullptr) {
+        std::vector<std::shared_ptr<Neuron>> selected;
+        selected.reserve(OutputIndices->size());
+        for (size_t index : *OutputIndices) {
+            selected.push_back(outputMarkers[index]);
+        }
+        outputMarkers.swap(selected);
+    }
+
+    // 1. 收集神经元
+    std::vector<std::shared_ptr<Neuron>> allNeurons;
+    std::unordered_map<const Neuron*, size_t> collectIndex;
+    auto collect = [&](const std::shared_ptr<Neuron>& neuron) {
+        if (neuron && collectIndex.emplace(neuron.get(), allNeurons.size()).second) {
+            allNeurons.push_back(neuron);
+            return true;
+        }
+        return false;
+    };
+    if (OutputIndices == nullptr) {
+        for (const auto& layer : ANetwork.GetLayers()) {
+            for (const auto& neuron : layer->GetNeurons()) {
+                collect(neuron);
+            }
+        }
+        for (const auto& marker : inputMarkers) {
+            collect(marker);
+        }
+        for (const auto& marker : outputMarkers) {
+            collect(marker);
+        }
+    }
+    else {
+        // 输入神经元全部保留，使输入向量与完整网络一致；再自输出沿树突反向遍历
+        for (const auto& marker : inputMarkers) {
+            collect(marker);
+        }
+        std::vector<std::shared_ptr<Neuron>> pending;
+        for (const auto& marker : outputMarkers) {
+            if (collect(marker)) {
+                pending.push_back(marker);
+            }
+        }
+        while (!pending.empty()) {
+            const std::shared_ptr<Neuron> neuron = pending.back();
+            pending.pop_back();
+            for (const auto& dendrite : neuron->GetDendrites()) {
+                const std::shared_ptr<Neuron> source = dendrite->GetSource();
+                if (collect(source)) {
+                    pending.push_back(source);
+                }
+            }
+        }
+    }
+    const size_t count = allNeurons.size();
+    // 编号以32位存放，gather指令要求其不超过有符号32位整数范围
+    if (count > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+        throw std::runtime_error("Network is too large for 32-bit plan indices");
+    }
+
+    // 2. 沿网络缓存的拓扑顺序计算每个神经元的层级（最长路径深度）
+    std::vector<size_t> level(count, 0);
+    for (const auto& neuron : ANetwork.GetTopologicalOrder()) {
+        auto found = collectIndex.find(neuron.get());
+        if (found == collectIndex.end()) {
+            continue;
+        }
+        size_t idx = found->second;
+        for (const auto& dendrite : neuron->GetDendrites()) {
+            auto it = collectIndex.find(dendrite->GetSource().get());
+            if (it != collectIndex.end()) {
+                level[idx] = std::max(level[idx], level[it->second] + 1);
+            }
+        }
+    }
+
+    // 3. 确定编号：输入神经元按标记顺序排在最前，其余按（层级，收集顺序）排列
+    std::vector<size_t> inputRank(count, count);
+    for (const auto& marker : inputMarkers) {
+        size_t idx = collectIndex[marker.get()];
+        if (inputRank[idx] == count) {
+            inputRank[idx] = m_InputCount++;
+        }
+    }
+    std::vector<size_t> order(count);
+    for (size_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        bool aInput = inputRank[a] != count;
+        bool bInput = inputRank[b] != count;
+        if (aInput != bInput) {
+            return aInput;
+        }
+        if (aInput) {
+            return inputRank[a] < inputRank[b];
+        }
+        return level[a] < level[b];
+    });
+    std::vector<size_t> planIndex(count);
+    for (size_t i = 0; i < count; ++i) {
+        planIndex[order[i]] = i;
+    }
+
+    // 4. 按编号填充连续数组
+    m_Neurons.reserve(count);
+    m_Level.reserve(count);
+    m_Bias.reserve(count);
+    m_Activation.reserve(count);
+    m_RowStart.reserve(count + 1);
+    m_RowStart.push_back(0);
+    for (size_t i = 0; i < count; ++i) {
+        const auto& neuron = allNeurons[order[i]];
+        m_Neurons.push_back(neuron);
+        m_Level.push_back(level[order[i]]);
+        m_Bias.push_back(neuron->GetBias());
+        m_Activation.push_back(neuron->GetActivationType());
+        for (const auto& dendrite : neuron->GetDendrites()) {
+            auto it = collectIndex.find(dendrite->GetSource().get());
+            if (it != collectIndex.end()) {
+                m_Source.push_back(static_cast<uint32_t>(planIndex[it->second]));
+                m_Weight.push_back(dendrite->GetWeight());
+            }
+        }
+        m_RowStart.push_back(m_Source.size());
+    }
+    for (const auto& marker : inputMarkers) {
+        m_InputIndex.push_back(planIndex[collectIndex[marker.get()]]);
+    }
+    for (const auto& marker : outputMarkers) {
+        m_OutputIndex.push_back(planIndex[collectIndex[marker.get()]]);
+    }
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：GetNeuronCount
+// 功能：获取神经元数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 神经元数
+size_t NetworkGraph::GetNeuronCount() const {
+    return m_Neurons.size();
+}
+
+// 函数名：GetInputCount
+// 功能：获取输入神经元数（去除重复标记后）
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 输入神经元数
+size_t NetworkGraph::GetInputCount() const {
+    return m_InputCount;
+}
+
+// 函数名：GetNeuron
+// 功能：获取编号对应的神经元
+// 入口参数：size_t Index 编号
+// 出口参数：无
+// 返回值：const std::shared_ptr<Neuron>& 神经元
+const std::shared_ptr<Neuron>& NetworkGraph::GetNeuron(size_t Index) const {
+    return m_Neurons[Index];
+}
+
+// 函数名：GetLevel
+// 功能：获取各神经元的层级
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<size_t>& 层级列表
+const std::vector<size_t>& NetworkGraph::GetLevel() const {
+    return m_Level;
+}
+
+// 函数名：GetBias
+// 功能：获取各神经元偏置
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<double>& 偏置列表
+const std::vector<double>& NetworkGraph::GetBias() const {
+    return m_Bias;
+}
+
+// 函数名：GetActivation
+// 功能：获取各神经元激活函数类型码
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<int>& 类型码列表
+const std::vector<int>& NetworkGraph::GetActivation() const {
+    return m_Activation;
+}
+
+// 函数名：GetRowStart
+// 功能：获取CSR行起点
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<size_t>& 行起点列表，长度为神经元数加一
+const std::vector<size_t>& NetworkGraph::GetRowStart() const {
+    return m_RowStart;
+}
+
+// 函数名：GetSource
+// 功能：获取树突源神经元编号
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<uint32_t>& 源编号列表
+const std::vector<uint32_t>& NetworkGraph::GetSource() const {
+    return m_Source;
+}
+
+// 函数名：GetWeight
+// 功能：获取树突权重
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<double>& 权重列表
+const std::vector<double>& NetworkGraph::GetWeight() const {
+    return m_Weight;
+}
+
+// 函数名：GetInputIndex
+// 功能：获取输入标记对应的编号
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<size_t>& 编号列表
+const std::vector<size_t>& NetworkGraph::GetInputIndex() const {
+    return m_InputIndex;
+}
+
+// 函数名：GetOutputIndex
+// 功能：获取输出标记对应的编号
+// 入口参数：无
+// 出口参数：无
+// 返回值：const std::vector<size_t>& 编号列表
+const std::vector<size_t>& NetworkGraph::GetOutputIndex() const {
+    return m_OutputIndex;
+}
+//------------------------------------------------------------------------------
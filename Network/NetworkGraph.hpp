@@ -0,0 +1,115 @@
+//
+//  NetworkGraph.hpp
+//
+//  Created by 孙李智 on 2026/10/18.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】NetworkGraph.hpp
+//【功能模块和目的】网络扁平化图类声明：把对象图形式的网络降为按拓扑层级编号的
+//       连续数组（偏置、激活类型、树突CSR、输入输出索引），供编译计划、增量推理会话、
+//       任务图执行器等共用同一套收集、分层与编号规则
+//【开发者及日期】孙李智 2026/10/18
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef NetworkGraph_hpp
+#define NetworkGraph_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//uint32_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::shared_ptr所属头文件
+#include <memory>
+
+// 前向声明网络类，防止循环依赖
+class Network;
+// 前向声明神经元类
+class Neuron;
+
+//------------------------------------------------------------------------------
+//【类名】NetworkGraph
+//【功能】网络的扁平化快照。收集神经元（整个网络，或指定输出沿树突反向可达的锥
+//       与全部输入神经元），按网络缓存的拓扑顺序计算层级（最长路径深度），
+//       再编号：输入神经元按标记顺序排在最前，其余按（层级，收集顺序）排列。
+//       按编号复制偏置、激活类型，树突连接存为CSR，只保留收集到的源神经元
+//【接口说明】
+//    以Network与可选的输出序号为参数构造，神经元数超出32位索引范围时抛出异常
+//    拷贝构造函数、赋值运算符，默认实现
+//    获取神经元数、输入神经元数、各编号对应的神经元与层级
+//    获取偏置、激活类型、CSR与输入输出索引数组
+//【开发者及日期】 孙李智 2026/10/18
+//【更改记录】
+//------------------------------------------------------------------------------
+class NetworkGraph {
+public:
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 由网络构造。OutputIndices为空指针时收集整个网络（层内神经元在前，
+    // 标记神经元补充在后），否则只收集指定输出的反向锥与全部输入神经元；
+    // 调用者负责事先检查网络是否合理
+    explicit NetworkGraph(const Network& ANetwork,
+                          const std::vector<size_t>* OutputIndices = nullptr);
+    // 拷贝构造函数，默认实现
+    NetworkGraph(const NetworkGraph& Source) = default;
+    // 赋值运算符重载，默认实现
+    NetworkGraph& operator=(const NetworkGraph& Source) = default;
+    // 虚析构函数，默认实现
+    virtual ~NetworkGraph() = default;
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取神经元数
+    size_t GetNeuronCount() const;
+    // 获取输入神经元数，输入神经元占据编号[0, GetInputCount())
+    size_t GetInputCount() const;
+    // 获取编号对应的神经元
+    const std::shared_ptr<Neuron>& GetNeuron(size_t Index) const;
+    // 获取各神经元的层级（最长路径深度），非输入神经元按层级非降序排列
+    const std::vector<size_t>& GetLevel() const;
+    // 获取各神经元偏置
+    const std::vector<double>& GetBias() const;
+    // 获取各神经元激活函数类型码
+    const std::vector<int>& GetActivation() const;
+    // 获取CSR行起点：第i个神经元的树突位于[RowStart[i], RowStart[i+1])
+    const std::vector<size_t>& GetRowStart() const;
+    // 获取树突源神经元编号
+    const std::vector<uint32_t>& GetSource() const;
+    // 获取树突权重
+    const std::vector<double>& GetWeight() const;
+    // 获取输入标记对应的编号（按标记顺序，可重复）
+    const std::vector<size_t>& GetInputIndex() const;
+    // 获取输出标记（或指定输出）对应的编号
+    const std::vector<size_t>& GetOutputIndex() const;
+private:
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 各编号对应的神经元
+    std::vector<std::shared_ptr<Neuron>> m_Neurons;
+    // 输入神经元数量
+    size_t m_InputCount{0};
+    // 各神经元层级
+    std::vector<size_t> m_Level;
+    // 各神经元偏置
+    std::vector<double> m_Bias;
+    // 各神经元激活函数类型码
+    std::vector<int> m_Activation;
+    // CSR行起点
+    std::vector<size_t> m_RowStart;
+    // 树突源神经元编号
+    std::vector<uint32_t> m_Source;
+    // 树突权重
+    std::vector<double> m_Weight;
+    // 输入标记对应的编号
+    std::vector<size_t> m_InputIndex;
+    // 输出标记对应的编号
+    std::vector<size_t> m_OutputIndex;
+};
+//------------------------------------------------------------------------------
+
+#endif /* NetworkGraph_hpp */
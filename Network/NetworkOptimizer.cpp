@@ -0,0 +1,428 @@
+//
+//  NetworkOptimizer.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】NetworkOptimizer.cpp
+//【功能模块和目的】网络图优化类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/17 增加死神经元与零权重剪枝
+//            2026/10/18 剪枝后失去全部入边的神经元按常量并入后继偏置
+//------------------------------------------------------------------------------
+
+// NetworkOptimizer类所属头文件
+#include "NetworkOptimizer.hpp"
+// Layer类所属头文件
+#include "Layer.hpp"
+// Neuron类所属头文件
+#include "Neuron.hpp"
+// Synapse类所属头文件
+#include "Synapse.hpp"
+// ActivationFunction类所属头文件
+#include "ActivationFunction.hpp"
+// 异常基类所属头文件
+#include <stdexcept>
+// std::unordered_set所属头文件
+#include <unordered_set>
+// std::unordered_map所属头文件
+#include <unordered_map>
+// std::replace、std::remove、std::remove_if所属头文件
+#include <algorithm>
+// std::fabs所属头文件
+#include <cmath>
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：FoldLinear（静态）
+// 功能：线性折叠。线性激活的非输入输出神经元n = b + Σ w_s·s，
+//       对每条出边n→t（权重v）把v·w_s累加到s→t、v·b累加到t的偏置，再删除n。
+//       可折叠的神经元按所属层分组，组按拓扑顺序处理：整组划算时整组折叠，
+//       否则逐个判断。前面的组折叠后其源神经元成为后继的源，连续的线性层逐层合并
+// 入口参数：Network& ANetwork
+// 出口参数：Network& ANetwork 优化后的网络
+// 返回值：Report 优化报告
+NetworkOptimizer::Report NetworkOptimizer::FoldLinear(Network& ANetwork) {
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Cannot optimize an invalid network");
+    }
+    Report result;
+    size_t neuronsBefore = 0;
+    size_t synapsesBefore = 0;
+    Count(ANetwork, neuronsBefore, synapsesBefore);
+    // Layer::RemoveNeuron按全局索引查找，修改前先保证索引唯一
+    Renumber(ANetwork);
+    result.FlopsBefore = EstimateFlops(ANetwork);
+
+    std::unordered_set<std::shared_ptr<Neuron>> markers;
+    for (const auto& neuron : ANetwork.GetInputMarker()) {
+        markers.insert(neuron);
+    }
+    for (const auto& neuron : ANetwork.GetOutputMarker()) {
+        markers.insert(neuron);
+    }
+    // 拓扑顺序在修改过程中会失效，先复制一份；
+    // 折叠只会让后继获得更靠前的源，复制的顺序对剩余神经元始终有效
+    const std::vector<std::shared_ptr<Neuron>> order = ANetwork.GetTopologicalOrder();
+    // 按层分组，组内与组间都保持拓扑顺序（组的顺序为首个成员出现的顺序）
+    std::vector<std::vector<std::shared_ptr<Neuron>>> groups;
+    std::unordered_map<std::shared_ptr<Layer>, size_t> groupOfLayer;
+    for (const auto& neuron : order) {
+        auto layer = neuron->GetLayer();
+        if (markers.count(neuron) != 0
+            || neuron->GetActivationType() != ActivationFunction::LINEAR
+            || !layer) {
+            continue;
+        }
+        auto found = groupOfLayer.emplace(layer, groups.size());
+        if (found.second) {
+            groups.emplace_back();
+        }
+        groups[found.first->second].push_back(neuron);
+    }
+    for (const auto& group : groups) {
+        if (IsWorthFolding(group)) {
+            Fold(group);
+            continue;
+        }
+        for (const auto& neuron : group) {
+            const std::vector<std::shared_ptr<Neuron>> single{neuron};
+            if (IsWorthFolding(single)) {
+                Fold(single);
+            }
+        }
+    }
+    Finish(ANetwork, neuronsBefore, synapsesBefore, result);
+    return result;
+}
+
+// 函数名：Prune（静态）
+// 功能：剪枝。先删除|权重|<=Threshold的突触（从源轴突与目标树突列表中同时删除）；
+//       此后输入神经元不再可达的神经元输出为常量，按拓扑顺序求值并乘以权重
+//       并入可达后继的偏置后删除（常量输出神经元保留，偏置改为常量加权和，
+//       以零权重连接第一个输入神经元使网络保持合理）；
+//       最后从输出神经元出发沿树突反向遍历，删除未访问到的非输入神经元
+// 入口参数：Network& ANetwork, double Threshold 权重阈值，0表示只删除零权重
+// 出口参数：Network& ANetwork 剪枝后的网络
+// 返回值：Report 优化报告
+NetworkOptimizer::Report NetworkOptimizer::Prune(Network& ANetwork, double Threshold) {
+    if (!(Threshold >= 0.0)) {
+        throw std::invalid_argument("Pruning threshold must be non-negative");
+    }
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Cannot optimize an invalid network");
+    }
+    Report result;
+    size_t neuronsBefore = 0;
+    size_t synapsesBefore = 0;
+    Count(ANetwork, neuronsBefore, synapsesBefore);
+    // Layer::RemoveNeuron按全局索引查找，修改前先保证索引唯一
+    Renumber(ANetwork);
+    result.FlopsBefore = EstimateFlops(ANetwork);
+    // 拓扑顺序在修改过程中会失效，先复制一份；只删除突触时复制的顺序仍然有效
+    const std::vector<std::shared_ptr<Neuron>> order = ANetwork.GetTopologicalOrder();
+    const auto inputMarkers = ANetwork.GetInputMarker();
+    const auto outputMarkers = ANetwork.GetOutputMarker();
+
+    // 1. 删除可忽略的突触
+    auto negligible = [Threshold](const std::shared_ptr<Synapse>& synapse) {
+        return std::fabs(synapse->GetWeight()) <= Threshold;
+    };
+    for (const auto& layer : ANetwork.GetLayers()) {
+        for (const auto& neuron : layer->GetNeurons()) {
+            auto& dendrites = neuron->ModifyDendrites();
+            dendrites.erase(std::remove_if(dendrites.begin(), dendrites.end(), negligible),
+                            dendrites.end());
+            auto& axons = neuron->ModifyAxonOutputs();
+            axons.erase(std::remove_if(axons.begin(), axons.end(), negligible),
+                        axons.end());
+        }
+    }
+
+    // 2. 从输入神经元沿轴突正向求可达集，不可达的神经元输出为常量
+    std::unordered_set<std::shared_ptr<Neuron>> live(inputMarkers.begin(), inputMarkers.end());
+    std::vector<std::shared_ptr<Neuron>> pending(inputMarkers.begin(), inputMarkers.end());
+    while (!pending.empty()) {
+        auto neuron = pending.back();
+        pending.pop_back();
+        for (const auto& axon : neuron->GetAxonOutputs()) {
+            auto target = axon->GetTarget();
+            if (target && live.insert(target).second) {
+                pending.push_back(target);
+            }
+        }
+    }
+    const std::unordered_set<std::shared_ptr<Neuron>> outputs(outputMarkers.begin(),
+                                                              outputMarkers.end());
+    std::unordered_map<std::shared_ptr<Neuron>, double> constants;
+    std::vector<std::shared_ptr<Neuron>> folded;
+    for (const auto& neuron : order) {
+        if (live.count(neuron) != 0) {
+            continue;
+        }
+        // 不可达神经元的源也都不可达，已按拓扑顺序求值
+        double sum = neuron->GetBias();
+        for (const auto& dendrite : neuron->GetDendrites()) {
+            sum += dendrite->GetWeight() * constants[dendrite->GetSource()];
+        }
+        const double value = ActivationFunction::Evaluate(neuron->GetActivationType(), sum);
+        constants.emplace(neuron, value);
+        if (outputs.count(neuron) != 0) {
+            // 输出神经元不能删除：断开常量源，偏置取常量加权和，以零权重接回输入
+            for (const auto& dendrite : neuron->GetDendrites()) {
+                auto& axons = dendrite->GetSource()->ModifyAxonOutputs();
+                axons.erase(std::remove(axons.begin(), axons.end(), dendrite), axons.end());
+            }
+            neuron->ModifyDendrites().clear();
+            neuron->SetBias(sum);
+            auto synapse = std::make_shared<Synapse>(inputMarkers.front(), neuron, 0.0);
+            inputMarkers.front()->AddAxonOutput(synapse);
+            neuron->AddDendrite(synapse);
+            continue;
+        }
+        for (const auto& axon : neuron->GetAxonOutputs()) {
+            auto target = axon->GetTarget();
+            if (live.count(target) != 0) {
+                target->SetBias(target->GetBias() + axon->GetWeight() * value);
+            }
+        }
+        folded.push_back(neuron);
+    }
+    // RemoveNeuron同时删除其连接
+    for (const auto& neuron : folded) {
+        neuron->GetLayer()->RemoveNeuron(neuron->GetIndex());
+    }
+
+    // 3. 从输出神经元反向求可达集
+    std::unordered_set<std::shared_ptr<Neuron>> reachable;
+    for (const auto& neuron : outputMarkers) {
+        if (reachable.insert(neuron).second) {
+            pending.push_back(neuron);
+        }
+    }
+    while (!pending.empty()) {
+        auto neuron = pending.back();
+        pending.pop_back();
+        for (const auto& dendrite : neuron->GetDendrites()) {
+            auto source = dendrite->GetSource();
+            if (source && reachable.insert(source).second) {
+                pending.push_back(source);
+            }
+        }
+    }
+    for (const auto& neuron : inputMarkers) {
+        reachable.insert(neuron);
+    }
+
+    // 4. 删除不可达神经元（RemoveNeuron同时删除其连接）
+    for (const auto& layer : ANetwork.GetLayers()) {
+        // 删除会修改层的神经元列表，先复制
+        const std::vector<std::shared_ptr<Neuron>> neurons = layer->GetNeurons();
+        for (const auto& neuron : neurons) {
+            if (reachable.count(neuron) == 0) {
+                layer->RemoveNeuron(neuron->GetIndex());
+            }
+        }
+    }
+    Finish(ANetwork, neuronsBefore, synapsesBefore, result);
+    return result;
+}
+
+// 函数名：EstimateFlops（静态）
+// 功能：估算单次推理的浮点运算次数（不含激活函数本身）
+// 入口参数：const Network& ANetwork
+// 出口参数：无
+// 返回值：size_t 2×突触数 + 神经元数
+size_t NetworkOptimizer::EstimateFlops(const Network& ANetwork) {
+    size_t neuronCount = 0;
+    size_t synapseCount = 0;
+    Count(ANetwork, neuronCount, synapseCount);
+    return 2 * synapseCount + neuronCount;
+}
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Count（静态）
+// 功能：统计网络各层中的神经元数与突触数（按树突计数）
+// 入口参数：const Network& ANetwork
+// 出口参数：size_t& NeuronCount, size_t& SynapseCount
+// 返回值：无
+void NetworkOptimizer::Count(const Network& ANetwork,
+                             size_t& NeuronCount, size_t& SynapseCount) {
+    NeuronCount = 0;
+    SynapseCount = 0;
+    for (const auto& layer : ANetwork.GetLayers()) {
+        for (const auto& neuron : layer->GetNeurons()) {
+            ++NeuronCount;
+            SynapseCount += neuron->GetDendriteCount();
+        }
+    }
+}
+
+// 函数名：IsWorthFolding（静态）
+// 功能：不修改网络，模拟消去一组神经元：按拓扑顺序求出每个成员折叠后的有效源
+//       （组外源直接保留，组内源展开为其有效源），再统计每个组外后继新增的
+//       源神经元数（已有连接只合并权重，不新增），与组内神经元关联的连接数比较
+// 入口参数：const std::vector<std::shared_ptr<Neuron>>& Group 按拓扑顺序排列
+// 出口参数：无
+// 返回值：bool 新增连接数不超过删除连接数时为true
+bool NetworkOptimizer::IsWorthFolding(const std::vector<std::shared_ptr<Neuron>>& Group) {
+    using NeuronSet = std::unordered_set<std::shared_ptr<Neuron>>;
+    std::unordered_map<std::shared_ptr<Neuron>, NeuronSet> effective;
+    for (const auto& neuron : Group) {
+        effective.emplace(neuron, NeuronSet());
+    }
+    size_t removed = 0;
+    // 组外后继及其将获得的源
+    std::unordered_map<std::shared_ptr<Neuron>, NeuronSet> incoming;
+    for (const auto& neuron : Group) {
+        NeuronSet& sources = effective[neuron];
+        for (const auto& dendrite : neuron->GetDendrites()) {
+            auto source = dendrite->GetSource();
+            auto member = effective.find(source);
+            if (member == effective.end()) {
+                sources.insert(source);
+                ++removed;
+            }
+            else {
+                sources.insert(member->second.begin(), member->second.end());
+            }
+        }
+        for (const auto& axon : neuron->GetAxonOutputs()) {
+            auto target = axon->GetTarget();
+            if (effective.count(target) == 0) {
+                incoming[target].insert(sources.begin(), sources.end());
+            }
+            ++removed;
+        }
+    }
+    size_t added = 0;
+    for (const auto& item : incoming) {
+        NeuronSet existing;
+        for (const auto& dendrite : item.first->GetDendrites()) {
+            existing.insert(dendrite->GetSource());
+        }
+        for (const auto& source : item.second) {
+            if (existing.count(source) == 0) {
+                ++added;
+            }
+        }
+        if (added > removed) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 函数名：Fold（静态）
+// 功能：按拓扑顺序消去一组神经元：把每个神经元代入其全部后继后删除
+// 入口参数：const std::vector<std::shared_ptr<Neuron>>& Group 按拓扑顺序排列
+// 出口参数：无
+// 返回值：无
+void NetworkOptimizer::Fold(const std::vector<std::shared_ptr<Neuron>>& Group) {
+    for (const auto& neuron : Group) {
+        // 删除神经元会修改出边列表，先复制
+        const std::vector<std::shared_ptr<Synapse>> axons = neuron->GetAxonOutputs();
+        for (const auto& axon : axons) {
+            Substitute(neuron, axon->GetTarget(), axon->GetWeight());
+        }
+        neuron->GetLayer()->RemoveNeuron(neuron->GetIndex());
+    }
+}
+
+// 函数名：Substitute（静态）
+// 功能：把神经元n的仿射映射以权重Weight代入目标t：t的偏置加Weight·b_n，
+//       n的每个源s的连接s→t加Weight·w_s。突触权重不可修改，合并时以新突触
+//       替换旧突触在源轴突列表与目标树突列表中的位置
+// 入口参数：const std::shared_ptr<Neuron>& pNeuron 被消去的神经元
+//          const std::shared_ptr<Neuron>& pTarget 目标神经元
+//          double Weight n→t的连接权重
+// 出口参数：无
+// 返回值：无
+void NetworkOptimizer::Substitute(const std::shared_ptr<Neuron>& pNeuron,
+                                  const std::shared_ptr<Neuron>& pTarget,
+                                  double Weight) {
+    pTarget->SetBias(pTarget->GetBias() + Weight * pNeuron->GetBias());
+    // 目标已有的源神经元到树突位置的索引
+    std::unordered_map<std::shared_ptr<Neuron>, size_t> position;
+    auto& targetDendrites = pTarget->ModifyDendrites();
+    for (size_t i = 0; i < targetDendrites.size(); ++i) {
+        position.emplace(targetDendrites[i]->GetSource(), i);
+    }
+    for (const auto& dendrite : pNeuron->GetDendrites()) {
+        auto source = dendrite->GetSource();
+        const double weight = Weight * dendrite->GetWeight();
+        auto found = position.find(source);
+        if (found == position.end()) {
+            auto synapse = std::make_shared<Synapse>(source, pTarget, weight);
+            source->AddAxonOutput(synapse);
+            pTarget->AddDendrite(synapse);
+            position.emplace(source, targetDendrites.size() - 1);
+        }
+        else {
+            std::shared_ptr<Synapse> old = targetDendrites[found->second];
+            auto merged = std::make_shared<Synapse>(source, pTarget,
+                                                    old->GetWeight() + weight);
+            auto& sourceAxons = source->ModifyAxonOutputs();
+            std::replace(sourceAxons.begin(), sourceAxons.end(), old, merged);
+            targetDendrites[found->second] = merged;
+        }
+    }
+}
+
+// 函数名：Compact（静态）
+// 功能：删除空层，再按层顺序重新编号神经元
+//       （ANN导出按层写出连续的索引区间）
+// 入口参数：Network& ANetwork
+// 出口参数：Network& ANetwork
+// 返回值：size_t 删除的层数
+size_t NetworkOptimizer::Compact(Network& ANetwork) {
+    std::vector<size_t> emptyLayers;
+    for (const auto& layer : ANetwork.GetLayers()) {
+        if (layer->GetNeuronCount() == 0) {
+            emptyLayers.push_back(layer->GetIndex());
+        }
+    }
+    for (size_t layerIndex : emptyLayers) {
+        ANetwork.RemoveLayer(layerIndex);
+    }
+    Renumber(ANetwork);
+    return emptyLayers.size();
+}
+
+// 函数名：Renumber（静态）
+// 功能：按层顺序把神经元全局索引重新编为0起的连续值
+// 入口参数：Network& ANetwork
+// 出口参数：Network& ANetwork
+// 返回值：无
+void NetworkOptimizer::Renumber(Network& ANetwork) {
+    size_t next = 0;
+    for (const auto& layer : ANetwork.GetLayers()) {
+        for (const auto& neuron : layer->GetNeurons()) {
+            neuron->SetIndex(next++);
+        }
+    }
+}
+
+// 函数名：Finish（静态）
+// 功能：删除空层、重新编号并刷新结构版本号，再与优化前的统计比较填写报告
+// 入口参数：Network& ANetwork, size_t NeuronsBefore, size_t SynapsesBefore
+// 出口参数：Report& Result 填写删除数与优化后的计算量
+// 返回值：无
+void NetworkOptimizer::Finish(Network& ANetwork, size_t NeuronsBefore,
+                              size_t SynapsesBefore, Report& Result) {
+    Result.LayersRemoved = Compact(ANetwork);
+    ANetwork.Touch();
+    size_t neuronsAfter = 0;
+    size_t synapsesAfter = 0;
+    Count(ANetwork, neuronsAfter, synapsesAfter);
+    Result.NeuronsRemoved = NeuronsBefore - neuronsAfter;
+    Result.SynapsesRemoved = SynapsesBefore - synapsesAfter;
+    Result.FlopsAfter = EstimateFlops(ANetwork);
+}
@@ -0,0 +1,108 @@
+//
+//  NetworkOptimizer.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】NetworkOptimizer.hpp
+//【功能模块和目的】网络图优化类声明：在不改变推理结果的前提下化简网络结构
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/17 增加死神经元与零权重剪枝
+//            2026/10/18 剪枝后失去全部入边的神经元按常量折叠
+//------------------------------------------------------------------------------
+
+#ifndef NetworkOptimizer_hpp
+#define NetworkOptimizer_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::shared_ptr所属头文件
+#include <memory>
+//std::vector所属头文件
+#include <vector>
+//Network类所属头文件
+#include "Network.hpp"
+
+//------------------------------------------------------------------------------
+//【类名】NetworkOptimizer
+//【功能】网络图优化的静态函数集合，直接修改传入的网络（需要保留原网络时先赋值一份）。
+//       线性折叠：线性激活的非输入输出神经元的输出是其源神经元输出的仿射函数，
+//       把它代入每个后继（后继权重乘以其入边权重、后继偏置加上权重乘以其偏置）
+//       后即可删除。按拓扑顺序处理，连续的线性层由此合并为一次仿射变换。
+//       同一层中可折叠的神经元作为一组整体判断：只有整组代入后新增的连接数
+//       不超过删除的连接数时才折叠，保证计算量不增加（例如窄的线性瓶颈层不折叠）；
+//       整组不划算时再逐个判断，权重1、偏置0的恒等神经元等单入边神经元总会被消去。
+//       剪枝：删除绝对值不超过阈值的突触，再从输出神经元沿树突反向求可达集，
+//       删除不可达（对任何输出都没有贡献）的神经元（与Layer::RemoveNeuron语义相同，
+//       同时删除其全部连接）；输入神经元是网络接口，始终保留。
+//       阈值为0时只删除权重恰为0的突触，推理结果不变
+//       优化后删除空层，并按层顺序把神经元全局索引重新编为连续值
+//【接口说明】
+//    静态：线性折叠，返回优化报告，网络不合理时抛出std::runtime_error
+//    静态：按权重阈值剪枝，返回优化报告，网络不合理时抛出std::runtime_error
+//    静态：估算网络单次推理的浮点运算次数
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】2026/10/17 增加剪枝
+//------------------------------------------------------------------------------
+class NetworkOptimizer {
+public:
+    //--------------------------------------------------------------------------
+    //与数据交换相关的内嵌类
+    //--------------------------------------------------------------------------
+    // 优化报告
+    class Report {
+    public:
+        // 删除的神经元数
+        size_t NeuronsRemoved{0};
+        // 删除的突触数（净值）
+        size_t SynapsesRemoved{0};
+        // 删除的空层数
+        size_t LayersRemoved{0};
+        // 优化前估算的单次推理浮点运算次数
+        size_t FlopsBefore{0};
+        // 优化后估算的单次推理浮点运算次数
+        size_t FlopsAfter{0};
+    };
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 只有静态成员，禁止构造
+    NetworkOptimizer() = delete;
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    // 线性折叠：消去线性激活的中间神经元，网络不合理时抛出std::runtime_error
+    static Report FoldLinear(Network& ANetwork);
+    // 剪枝：删除|权重|<=Threshold的突触与对输出不可达的神经元，
+    // 因此失去全部入边的神经元按常量并入后继偏置，
+    // 阈值为负时抛出std::invalid_argument，网络不合理时抛出std::runtime_error
+    static Report Prune(Network& ANetwork, double Threshold = 0.0);
+    // 估算单次推理的浮点运算次数：每个突触一次乘法一次加法，每个神经元一次偏置加法
+    static size_t EstimateFlops(const Network& ANetwork);
+private:
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 统计网络中的神经元数与突触数
+    static void Count(const Network& ANetwork, size_t& NeuronCount, size_t& SynapseCount);
+    // 判断消去一组神经元（按拓扑顺序）后新增的连接数是否不超过删除的连接数
+    static bool IsWorthFolding(const std::vector<std::shared_ptr<Neuron>>& Group);
+    // 按拓扑顺序消去一组神经元
+    static void Fold(const std::vector<std::shared_ptr<Neuron>>& Group);
+    // 把神经元的仿射映射以权重Weight代入目标神经元，与已有连接合并
+    static void Substitute(const std::shared_ptr<Neuron>& pNeuron,
+                           const std::shared_ptr<Neuron>& pTarget,
+                           double Weight);
+    // 删除空层并按层顺序重新编号神经元，返回删除的层数
+    static size_t Compact(Network& ANetwork);
+    // 按层顺序把神经元全局索引重新编为0起的连续值
+    static void Renumber(Network& ANetwork);
+    // 整理网络并由优化前的神经元数、突触数填写报告
+    static void Finish(Network& ANetwork, size_t NeuronsBefore, size_t SynapsesBefore,
+                       Report& Result);
+};
+//------------------------------------------------------------------------------
+
+#endif /* NetworkOptimizer_hpp */
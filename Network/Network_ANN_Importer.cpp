@@ -177,5 +177,7 @@ Network Network_ANN_Importer::LoadFromStream(std::ifstream& Stream) const{
             }
         }
     }
+    // 突触直接建立于神经元之上，需手动刷新结构版本号
+    TempNetwork.Touch();
     return TempNetwork;
 }
@@ -0,0 +1,401 @@
+//
+//  Network_HPP_Exporter.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】Network_HPP_Exporter.cpp
+//【功能模块和目的】导出Network为自包含C++头文件的导出器类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/18 神经元数超过STACK_NEURON_LIMIT时infer的工作数组改为线程局部静态数组
+//            2026/10/18 偏置或权重转为float后不是有限值时拒绝导出
+//------------------------------------------------------------------------------
+
+//自身类头文件
+#include "Network_HPP_Exporter.hpp"
+//CompiledNetwork类所属头文件（DENSE_DENSITY）
+#include "CompiledNetwork.hpp"
+//Neuron类所属头文件
+#include "Neuron.hpp"
+//Synapse类所属头文件
+#include "Synapse.hpp"
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::stable_sort、std::min、std::max所属头文件
+#include <algorithm>
+//哈希映射头文件，用于存储神经元到编号的映射
+#include <unordered_map>
+//异常基类所属头文件
+#include <stdexcept>
+//用于控制浮点数输出格式
+#include <iomanip>
+//std::isalnum、std::isdigit所属头文件
+#include <cctype>
+//std::is_floating_point所属头文件
+#include <type_traits>
+//std::isfinite所属头文件
+#include <cmath>
+
+//------------------------------------------------------------------------------
+//文件内辅助函数
+//------------------------------------------------------------------------------
+
+//函数名：WriteArray
+//功能：输出数组初始化列表，每行8个元素
+//入口参数：std::ofstream& Stream, const std::vector<E>& Values
+//出口参数：std::ofstream& Stream
+//返回值：无
+template<class E>
+static void WriteArray(std::ofstream& Stream, const std::vector<E>& Values) {
+    Stream << "{";
+    for (size_t i = 0; i < Values.size(); ++i) {
+        Stream << (i % 8 == 0 ? "\n    " : " ") << Values[i];
+        if constexpr (std::is_floating_point<E>::value) {
+            Stream << "f";
+        }
+        if (i + 1 < Values.size()) {
+            Stream << ",";
+        }
+    }
+    Stream << "\n};\n";
+}
+
+//函数名：WriteMatrix
+//功能：输出二维数组初始化列表，每行一个子列表
+//入口参数：std::ofstream& Stream, const std::vector<float>& Values 行主序元素,
+//          size_t cols 列数
+//出口参数：std::ofstream& Stream
+//返回值：无
+static void WriteMatrix(std::ofstream& Stream, const std::vector<float>& Values, size_t cols) {
+    Stream << "{";
+    for (size_t r = 0; r * cols < Values.size(); ++r) {
+        Stream << "\n    {";
+        for (size_t c = 0; c < cols; ++c) {
+            Stream << (c % 8 == 0 ? "\n        " : " ") << Values[r * cols + c] << "f";
+            if (c + 1 < cols) {
+                Stream << ",";
+            }
+        }
+        Stream << "\n    }" << ((r + 1) * cols < Values.size() ? "," : "");
+    }
+    Stream << "\n};\n";
+}
+
+//函数名：ActivationExpression
+//功能：获取内联激活函数表达式（float计算），与ActivationFunction::createAF的类型码一致
+//入口参数：int Type 激活类型，const std::string& x 自变量表达式
+//出口参数：无
+//返回值：std::string 表达式，未知类型抛出std::runtime_error
+static std::string ActivationExpression(int Type, const std::string& x) {
+    switch (Type) {
+        // 线性激活
+        case 0:
+            return x;
+        // Sigmoid激活
+        case 1:
+            return "1.0f / (1.0f + std::exp(-" + x + "))";
+        // Tanh激活
+        case 2:
+            return "std::tanh(" + x + ")";
+        // ReLU激活
+        case 3:
+            return "(" + x + " > 0.0f ? " + x + " : 0.0f)";
+        // 非法处理
+        default:
+            throw std::runtime_error("Unknown activation type for code generation");
+    }
+}
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+//函数名：Network_HPP_Exporter
+//功能：默认构造函数，手动触发基类构造函数，指定文件扩展名为"hpp"
+//入口参数：无
+//出口参数：无
+//返回值：无
+Network_HPP_Exporter::Network_HPP_Exporter()
+: Exporter<Network>(std::string{"hpp"}){
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数：需检查所有Getter是否有后置const
+//------------------------------------------------------------------------------
+
+//函数名：SaveToStream const
+//功能：将Network类型对象导出为C++头文件。
+//      1. 编号：输入标记神经元在前（值为输入加偏置），其余按波前、组内按激活类型排列；
+//      2. 每组输出偏置数组与稠密或CSR权重数组；
+//      3. 输出infer函数：逐组计算加权和并内联激活，最后按输出标记复制结果
+//入口参数：std::ofstream& Stream, const Network& ANetwork
+//出口参数：std::ofstream& Stream
+//返回值：无，网络不合理或偏置、权重转为float后不是有限值（无法写成浮点字面量）时
+//        抛出std::runtime_error，此时不写出任何内容
+void Network_HPP_Exporter::SaveToStream(std::ofstream& Stream, const Network& ANetwork) const {
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Network is not valid for code generation");
+    }
+    // 1. 编号：输入标记按顺序在前，其余按波前顺序、同一波前内按激活类型稳定排序
+    std::vector<std::shared_ptr<Neuron>> neurons;
+    std::unordered_map<const Neuron*, size_t> index;
+    for (const auto& marker : ANetwork.GetInputMarker()) {
+        if (marker && index.emplace(marker.get(), neurons.size()).second) {
+            neurons.push_back(marker);
+        }
+    }
+    const size_t inputCount = neurons.size();
+    // 组：编号区间[Begin, End)内的神经元位于同一波前且激活类型相同
+    struct Group {
+        size_t Begin;
+        size_t End;
+        int Activation;
+    };
+    std::vector<Group> groups;
+    for (const auto& front : ANetwork.GetWavefronts()) {
+        std::vector<std::shared_ptr<Neuron>> members;
+        for (const auto& neuron : front) {
+            if (index.find(neuron.get()) == index.end()) {
+                members.push_back(neuron);
+            }
+        }
+        std::stable_sort(members.begin(), members.end(),
+            [](const std::shared_ptr<Neuron>& a, const std::shared_ptr<Neuron>& b) {
+                return a->GetActivationType() < b->GetActivationType();
+            });
+        // 每个波前从新组开始，组内神经元互不依赖
+        const size_t frontBegin = neurons.size();
+        for (const auto& neuron : members) {
+            const int type = neuron->GetActivationType();
+            if (neurons.size() == frontBegin || groups.back().Activation != type) {
+                groups.push_back(Group{neurons.size(), neurons.size(), type});
+            }
+            index.emplace(neuron.get(), neurons.size());
+            neurons.push_back(neuron);
+            ++groups.back().End;
+        }
+    }
+
+    // 非有限值会输出为inff、nanf，生成的头文件无法编译，写出前先行检查
+    for (const auto& neuron : neurons) {
+        if (!std::isfinite(static_cast<float>(neuron->GetBias()))) {
+            throw std::runtime_error("Non-finite bias cannot be exported as C++ code");
+        }
+        for (const auto& dendrite : neuron->GetDendrites()) {
+            if (dendrite && index.find(dendrite->GetSource().get()) != index.end()
+                && !std::isfinite(static_cast<float>(dendrite->GetWeight()))) {
+                throw std::runtime_error("Non-finite weight cannot be exported as C++ code");
+            }
+        }
+    }
+
+    // 2. 文件头：以网络名称为命名空间与头文件保护宏
+    const std::string name = Identifier(ANetwork.Name);
+    // 注释中的原名称去掉控制字符（导入的名称可能带有行尾'\r'）
+    std::string title;
+    for (char ch : ANetwork.Name) {
+        if (static_cast<unsigned char>(ch) >= 0x20) {
+            title += ch;
+        }
+    }
+    const auto outputMarkers = ANetwork.GetOutputMarker();
+    Stream << "//\n"
+           << "//  " << name << ".hpp\n"
+           << "//\n"
+           << "//  由Network_HPP_Exporter从网络\"" << title << "\"生成，请勿手工修改\n"
+           << "//\n\n"
+           << "#ifndef " << name << "_hpp\n"
+           << "#define " << name << "_hpp\n\n"
+           << "//std::exp、std::tanh所属头文件\n"
+           << "#include <cmath>\n"
+           << "//std::size_t所属头文件\n"
+           << "#include <cstddef>\n\n"
+           << "namespace " << name << " {\n\n"
+           << "// 输入数量\n"
+           << "static constexpr std::size_t INPUT_COUNT{" << inputCount << "};\n"
+           << "// 输出数量\n"
+           << "static constexpr std::size_t OUTPUT_COUNT{" << outputMarkers.size() << "};\n"
+           << "// 神经元数量\n"
+           << "static constexpr std::size_t NEURON_COUNT{" << neurons.size() << "};\n\n";
+    // float按9位有效数字输出可精确还原
+    Stream << std::scientific << std::setprecision(8);
+    if (inputCount > 0) {
+        std::vector<float> bias;
+        for (size_t i = 0; i < inputCount; ++i) {
+            bias.push_back(static_cast<float>(neurons[i]->GetBias()));
+        }
+        Stream << "// 输入神经元偏置\n"
+               << "static constexpr float B0[" << inputCount << "] = ";
+        WriteArray(Stream, bias);
+        Stream << "\n";
+    }
+
+    // 3. 各组参数数组，同时生成对应的计算代码
+    std::string body;
+    for (size_t g = 0; g < groups.size(); ++g) {
+        const Group& group = groups[g];
+        const size_t rows = group.End - group.Begin;
+        const std::string id = std::to_string(g + 1);
+        // 按行收集（源编号，权重），并求源编号区间
+        std::vector<std::vector<std::pair<size_t, double>>> synapses(rows);
+        size_t lo = neurons.size();
+        size_t hi = 0;
+        size_t nnz = 0;
+        std::vector<float> bias;
+        for (size_t r = 0; r < rows; ++r) {
+            const auto& neuron = neurons[group.Begin + r];
+            bias.push_back(static_cast<float>(neuron->GetBias()));
+            for (const auto& dendrite : neuron->GetDendrites()) {
+                if (!dendrite || !dendrite->GetSource()) {
+                    continue;
+                }
+                auto it = index.find(dendrite->GetSource().get());
+                if (it == index.end()) {
+                    continue;
+                }
+                synapses[r].emplace_back(it->second, dendrite->GetWeight());
+                lo = std::min(lo, it->second);
+                hi = std::max(hi, it->second + 1);
+                ++nnz;
+            }
+        }
+        const size_t cols = nnz > 0 ? hi - lo : 0;
+        const bool dense = nnz > 0
+            && static_cast<double>(nnz) >= CompiledNetwork::DENSE_DENSITY * rows * cols;
+        const std::string target = "v[" + std::to_string(group.Begin) + " + r]";
+        const std::string rowLoop = "    for (std::size_t r = 0; r < " + std::to_string(rows) + "; ++r) {\n";
+
+        Stream << "// 第" << id << "组：神经元[" << group.Begin << ", " << group.End
+               << ")，激活类型" << group.Activation;
+        if (nnz > 0) {
+            Stream << (dense ? "，稠密" : "，稀疏") << "，源神经元[" << lo << ", " << hi << ")";
+        }
+        Stream << "\nstatic constexpr float B" << id << "[" << rows << "] = ";
+        WriteArray(Stream, bias);
+
+        body += "    // 第" + id + "组\n";
+        if (dense) {
+            // 稠密组按列存放（W[c][r]），逐列把源值乘到各行的加权和上，
+            // 最内层循环连续且无归约依赖，不需要浮点重结合即可向量化；
+            // 重复突触的权重累加到同一位置
+            std::vector<double> matrix(cols * rows, 0.0);
+            for (size_t r = 0; r < rows; ++r) {
+                for (const auto& synapse : synapses[r]) {
+                    matrix[(synapse.first - lo) * rows + r] += synapse.second;
+                }
+            }
+            std::vector<float> weight(matrix.begin(), matrix.end());
+            Stream << "static constexpr float W" << id
+                   << "[" << cols << "][" << rows << "] = ";
+            WriteMatrix(Stream, weight, rows);
+            body += rowLoop
+                  + "        " + target + " = B" + id + "[r];\n"
+                    "    }\n"
+                    "    for (std::size_t c = 0; c < " + std::to_string(cols) + "; ++c) {\n"
+                    "        const float x = v[" + std::to_string(lo) + " + c];\n"
+                    "    " + rowLoop
+                  + "            " + target + " += W" + id + "[c][r] * x;\n"
+                    "        }\n"
+                    "    }\n";
+            // 线性激活无需再处理
+            if (group.Activation != 0) {
+                body += rowLoop
+                      + "        " + target + " = "
+                      + ActivationExpression(group.Activation, target) + ";\n"
+                        "    }\n";
+            }
+            Stream << "\n";
+            continue;
+        }
+        body += rowLoop
+              + "        float s = B" + id + "[r];\n";
+        if (nnz > 0) {
+            std::vector<float> weight;
+            std::vector<size_t> source;
+            std::vector<size_t> rowStart{0};
+            for (size_t r = 0; r < rows; ++r) {
+                for (const auto& synapse : synapses[r]) {
+                    source.push_back(synapse.first);
+                    weight.push_back(static_cast<float>(synapse.second));
+                }
+                rowStart.push_back(source.size());
+            }
+            Stream << "static constexpr float W" << id << "[" << nnz << "] = ";
+            WriteArray(Stream, weight);
+            Stream << "static constexpr unsigned S" << id << "[" << nnz << "] = ";
+            WriteArray(Stream, source);
+            Stream << "static constexpr unsigned R" << id << "[" << rows + 1 << "] = ";
+            WriteArray(Stream, rowStart);
+            body += "        for (unsigned k = R" + id + "[r]; k < R" + id + "[r + 1]; ++k) {\n"
+                    "            s += W" + id + "[k] * v[S" + id + "[k]];\n"
+                    "        }\n";
+        }
+        body += "        " + target + " = " + ActivationExpression(group.Activation, "s") + ";\n"
+                "    }\n";
+        Stream << "\n";
+    }
+
+    // 4. 推理函数
+    Stream << "// 推理：input为INPUT_COUNT个输入，output为OUTPUT_COUNT个输出\n"
+           << "inline void infer(const float* input, float* output) {\n";
+    if (neurons.size() > STACK_NEURON_LIMIT) {
+        // 每次推理先写后读，线程局部数组无需清零，各线程互不干扰
+        Stream << "    // 神经元较多，工作数组放在线程局部静态存储中，避免栈溢出\n"
+               << "    static thread_local float v[NEURON_COUNT];\n";
+    } else {
+        Stream << "    float v[NEURON_COUNT > 0 ? NEURON_COUNT : 1];\n";
+    }
+    if (inputCount > 0) {
+        Stream << "    for (std::size_t i = 0; i < INPUT_COUNT; ++i) {\n"
+               << "        v[i] = input[i] + B0[i];\n"
+               << "    }\n";
+    } else {
+        Stream << "    (void)input;\n";
+    }
+    Stream << body;
+    for (size_t i = 0; i < outputMarkers.size(); ++i) {
+        auto it = index.find(outputMarkers[i].get());
+        if (it == index.end()) {
+            throw std::runtime_error("Output neuron is not reachable for code generation");
+        }
+        Stream << "    output[" << i << "] = v[" << it->second << "];\n";
+    }
+    Stream << "}\n\n"
+           << "} // namespace " << name << "\n\n"
+           << "#endif /* " << name << "_hpp */\n";
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+//函数名：Identifier（静态）
+//功能：由网络名称得到合法的C++标识符。连续的非法字符合并为一个'_'，
+//      去掉首尾的'_'，避免产生以'_'开头或含"__"的保留标识符
+//入口参数：const std::string& Name
+//出口参数：无
+//返回值：std::string 标识符
+std::string Network_HPP_Exporter::Identifier(const std::string& Name) {
+    std::string result;
+    for (char ch : Name) {
+        if (std::isalnum(static_cast<unsigned char>(ch))) {
+            result += ch;
+        } else if (!result.empty() && result.back() != '_') {
+            result += '_';
+        }
+    }
+    if (!result.empty() && result.back() == '_') {
+        result.pop_back();
+    }
+    if (result.empty() || std::isdigit(static_cast<unsigned char>(result.front()))) {
+        result = "ANN_" + result;
+    }
+    return result;
+}
+//------------------------------------------------------------------------------
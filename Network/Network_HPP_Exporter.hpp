@@ -0,0 +1,85 @@
+//
+//  Network_HPP_Exporter.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】Network_HPP_Exporter.hpp
+//【功能模块和目的】导出Network为自包含C++头文件（预先生成推理代码）的导出器类声明
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef Network_HPP_Exporter_hpp
+#define Network_HPP_Exporter_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::ofstream所属头文件
+#include <fstream>
+//std::string所属头文件
+#include <string>
+//Exporter基类模版所属头文件
+#include "Exporter.hpp"
+//Network类所属头文件
+#include "Network.hpp"
+
+using Network_Exporter = Exporter<Network>;
+
+//------------------------------------------------------------------------------
+//【类名】Network_HPP_Exporter
+//【功能】导出Network为自包含C++头文件的导出器。生成的头文件只依赖<cmath>、<cstddef>，
+//       以网络名称为命名空间，偏置、权重保存为static constexpr float数组，
+//       并生成inline void infer(const float* input, float* output)：
+//       神经元按（输入标记，波前，激活类型）编号，同一波前内激活类型相同的神经元
+//       为一组，每组生成一段常量边界的循环，激活函数直接内联；
+//       组内源神经元连续区间的密度不低于CompiledNetwork::DENSE_DENSITY时生成
+//       按列存放的稠密二维权重数组（最内层循环无归约依赖，可直接向量化），
+//       否则生成CSR数组。神经元数超过STACK_NEURON_LIMIT时infer的工作数组改为
+//       static thread_local，避免大模型在栈上分配而溢出
+//【接口说明】
+//    继承得到全部基类接口
+//    默认构造函数，手动触发基类构造函数，指定文件扩展名为"hpp"
+//    虚析构函数（可能做基类）
+//    派生类接口：将Network类型对象导出到文件流的接口override
+//    静态：由网络名称得到合法的C++标识符
+//【特殊使用说明】需要手动调用Network_Exporter::Register<Network_HPP_Exporter>()，注册类
+//             之后可以通过Network_Exporter::GetInstanceXXX获取具体导出器实例
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】2026/10/18 神经元数超过STACK_NEURON_LIMIT时工作数组不放在栈上
+//            2026/10/18 偏置或权重不是有限float值时拒绝导出
+//------------------------------------------------------------------------------
+class Network_HPP_Exporter : public Exporter<Network>{
+public:
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    //默认构造函数，手动触发基类构造函数，指定文件扩展名为"hpp"
+    Network_HPP_Exporter();
+    //无拷贝构造，因为基类没有
+    Network_HPP_Exporter(const Network_HPP_Exporter&) = delete;
+    //无赋值运算符，因为基类没有
+    Network_HPP_Exporter& operator=(const Network_HPP_Exporter&) = delete;
+    //虚析构函数（可能做基类），无动态构造成员，默认实现
+    virtual ~Network_HPP_Exporter() = default;
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数：需检查所有Getter是否有后置const
+    //--------------------------------------------------------------------------
+    //将Network类型对象导出到文件流的接口override，网络不合理或偏置、权重转为float后
+    //不是有限值时抛出std::runtime_error
+    virtual void SaveToStream
+         (std::ofstream& Stream, const Network& ANetwork) const override;
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    //由网络名称得到C++标识符：连续非法字符合并为一个'_'并去掉首尾'_'，空名或数字开头时加前缀"ANN_"
+    static std::string Identifier(const std::string& Name);
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    //infer工作数组放在栈上的最大神经元数（64KB），超过时使用线程局部静态数组
+    static constexpr size_t STACK_NEURON_LIMIT{16384};
+};
+
+#endif /* Network_HPP_Exporter_hpp */
@@ -10,6 +10,8 @@
 //【功能描述】    实现神经元的构造、析构、赋值、激活函数设置等功能
 //【开发者及日期】孙李智 2025-07-13
 //【更改记录】
+//            2026/10/17 修改偏置、激活函数时刷新所属层的结构版本号
+//            2026/10/17 激活函数按类型码内联计算，不再逐个创建对象
 //---------------------------------------------------------------------
 
 // Neuron类头文件
@@ -18,6 +20,8 @@
 #include "ActivationFunction.hpp"
 // Synapse类头文件
 #include "Synapse.hpp"
+// Layer类头文件
+#include "Layer.hpp"
 // 异常基类头文件
 #include <stdexcept>
 // std::vector所属头文件
@@ -93,8 +97,8 @@ void Neuron::Forward() const{
     }
     // 加上偏置
     sum += m_rbias;
-    // 应用激活函数
-    m_routput = (*m_activation)(sum);
+    // 应用激活函数（按类型码内联分派）
+    m_routput = ActivationFunction::Evaluate(m_ActivationType, sum);
 }
 
 // 函数名：GetOutput
@@ -116,12 +120,15 @@ void Neuron::InputMarkSetOutput(double input){
 }
 
 // 函数名：SetBias
-// 功能：设置偏置
+// 功能：设置偏置，并刷新所属层的结构版本号，使编译计划与推理缓存失效
 // 入口参数：double bias
 // 出口参数：无
 // 返回值：无
 void Neuron::SetBias(double bias) {
     m_rbias = bias;
+    if (m_player) {
+        m_player->Touch();
+    }
 }
 
 // 函数名：GetBias
@@ -134,17 +141,19 @@ double Neuron::GetBias() const{
 }
 
 // 函数名：SetActivation
-// 功能：设置激活函数
+// 功能：设置激活函数类型。激活函数无状态，只保存类型码，
+//       前向计算时由ActivationFunction::Evaluate分派
 // 入口参数：int activationType
 // 出口参数：无
 // 返回值：无
 void Neuron::SetActivation(int activationType) {
-    m_ActivationType = activationType;
-    // 创建激活函数对象，静态调用createAF
-    m_activation = ActivationFunction::createAF(m_ActivationType);
-    if (!m_activation) {
+    if (!ActivationFunction::IsValidType(activationType)) {
         throw std::runtime_error("Failed to create activation function");
     }
+    m_ActivationType = activationType;
+    if (m_player) {
+        m_player->Touch();
+    }
 }
 
 // 函数名：GetActivationTtpe
@@ -8,7 +8,7 @@
 //【文件名】Neuron.hpp
 //【功能模块和目的】神经元类声明
 //【开发者及日期】孙李智 2025/7/13
-//【更改记录】
+//【更改记录】2026/10/17 不再为每个神经元创建激活函数对象，按类型码分派
 //------------------------------------------------------------------------------
 
 #ifndef Neuron_hpp
@@ -126,8 +126,6 @@ private:
     double m_rbias;
     // 输出值
     mutable double m_routput;
-    // 激活函数指针
-    std::shared_ptr<ActivationFunction> m_activation;
     // 神经元所属Layer的指针
     std::shared_ptr<Layer> m_player;
     // 神经元的全局索引，用于唯一标识神经元在网络中的位置（区别在Layer中的局部索引）
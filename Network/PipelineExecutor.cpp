@@ -0,0 +1,333 @@
+//
+//  PipelineExecutor.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】PipelineExecutor.cpp
+//【功能模块和目的】流水线并行执行器类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/18 计划使用网络设置的激活近似方式
+//            2026/10/18 持续空闲时在条件变量上等待，不再循环休眠
+//------------------------------------------------------------------------------
+
+// PipelineExecutor类所属头文件
+#include "PipelineExecutor.hpp"
+// std::min、std::max所属头文件
+#include <algorithm>
+// std::numeric_limits所属头文件
+#include <limits>
+#if defined(__linux__)
+// pthread_setaffinity_np所属头文件
+#include <pthread.h>
+#endif
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：PipelineExecutor
+// 功能：构造函数。编译计划、划分阶段区间、分配槽与队列后启动工作线程
+// 入口参数：const Network& ANetwork, size_t StageCount 流水级数, bool Pin 是否绑定核心
+// 出口参数：无
+// 返回值：无，网络不合理时抛出std::runtime_error
+PipelineExecutor::PipelineExecutor(const Network& ANetwork, size_t StageCount, bool Pin)
+    : m_Plan(ANetwork, CompiledNetwork::PRECISION::DOUBLE, ANetwork.GetActivationApproximation()),
+      m_StatisticsStart(Clock::now().time_since_epoch().count()) {
+    const size_t parts = std::max<size_t>(1, std::min(StageCount, m_Plan.GetStageCount()));
+    const std::vector<size_t> bounds = Partition(parts);
+    // 每级同时至多处理一块，另留两块给调用线程写入输入和回收输出
+    const size_t slotCount = 2 * parts + 2;
+    m_Slots.resize(slotCount);
+    for (auto& slot : m_Slots) {
+        slot.Values.resize(m_Plan.GetNeuronCount() * CompiledNetwork::BATCH_TILE);
+    }
+    for (size_t p = 0; p < parts; ++p) {
+        auto worker = std::make_unique<Worker>();
+        worker->Begin = bounds[p];
+        worker->End = bounds[p + 1];
+        for (size_t s = worker->Begin; s < worker->End; ++s) {
+            worker->Cost += m_Plan.GetStageCost(s);
+        }
+        worker->Input = std::make_unique<SpscRing<Slot*>>(slotCount);
+        m_Workers.push_back(std::move(worker));
+    }
+    m_Done = std::make_unique<SpscRing<Slot*>>(slotCount);
+    const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t p = 0; p < parts; ++p) {
+        m_Workers[p]->Thread = std::thread(&PipelineExecutor::WorkerLoop, this, p);
+        if (Pin) {
+            // 核心0留给调用线程
+            PinThread(m_Workers[p]->Thread, (p + 1) % cores);
+        }
+    }
+}
+
+// 函数名：~PipelineExecutor
+// 功能：析构函数，通知工作线程停止并等待其结束
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+PipelineExecutor::~PipelineExecutor() {
+    m_Stop.store(true, std::memory_order_release);
+    Notify();
+    for (auto& worker : m_Workers) {
+        worker->Thread.join();
+    }
+}
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：InferenceBatch
+// 功能：批量推理。调用线程按块写入输入并送入第一级，空闲槽用完后
+//       从完成队列回收槽（其输出已由最后一级写出），最后等待全部块完成
+// 入口参数：const double* in 行主序输入矩阵, size_t batch 样本数
+// 出口参数：double* out 行主序输出矩阵
+// 返回值：无
+void PipelineExecutor::InferenceBatch(const double* in, size_t batch, double* out) {
+    std::lock_guard<std::mutex> lock(m_BatchMutex);
+    const size_t inputCount = m_Plan.GetInputCount();
+    const size_t outputCount = m_Plan.GetOutputCount();
+    std::vector<Slot*> free;
+    for (auto& slot : m_Slots) {
+        free.push_back(&slot);
+    }
+    size_t inFlight{0};
+    size_t spins{0};
+    for (size_t start = 0; start < batch; start += CompiledNetwork::BATCH_TILE) {
+        Slot* slot{nullptr};
+        while (free.empty()) {
+            const uint64_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+            if (m_Done->TryPop(slot)) {
+                Notify();
+                --inFlight;
+                free.push_back(slot);
+                spins = 0;
+            }
+            else {
+                Wait(spins, epoch);
+            }
+        }
+        slot = free.back();
+        free.pop_back();
+        slot->Tile = std::min(CompiledNetwork::BATCH_TILE, batch - start);
+        slot->Out = out + start * outputCount;
+        m_Plan.LoadInputs(in + start * inputCount, slot->Tile,
+                          slot->Values.data(), CompiledNetwork::BATCH_TILE);
+        for (;;) {
+            const uint64_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+            if (m_Workers.front()->Input->TryPush(slot)) {
+                break;
+            }
+            Wait(spins, epoch);
+        }
+        Notify();
+        ++inFlight;
+    }
+    spins = 0;
+    while (inFlight > 0) {
+        Slot* slot{nullptr};
+        const uint64_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+        if (m_Done->TryPop(slot)) {
+            Notify();
+            --inFlight;
+            spins = 0;
+        }
+        else {
+            Wait(spins, epoch);
+        }
+    }
+}
+
+// 函数名：ResetStatistics
+// 功能：清零各流水级统计并重新开始计时
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void PipelineExecutor::ResetStatistics() {
+    for (auto& worker : m_Workers) {
+        worker->Tiles.store(0, std::memory_order_relaxed);
+        worker->BusyNanoseconds.store(0, std::memory_order_relaxed);
+    }
+    m_StatisticsStart.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：GetStageCount
+// 功能：获取流水级数
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 流水级数
+size_t PipelineExecutor::GetStageCount() const {
+    return m_Workers.size();
+}
+
+// 函数名：GetStatistics
+// 功能：获取各流水级统计，利用率以自构造或清零统计以来的时间为分母
+// 入口参数：无
+// 出口参数：无
+// 返回值：std::vector<StageStatistics> 按流水级顺序排列
+std::vector<PipelineExecutor::StageStatistics> PipelineExecutor::GetStatistics() const {
+    const Clock::duration elapsed = Clock::now().time_since_epoch()
+        - Clock::duration(m_StatisticsStart.load(std::memory_order_relaxed));
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    std::vector<StageStatistics> result;
+    for (const auto& worker : m_Workers) {
+        StageStatistics statistics;
+        statistics.FirstStage = worker->Begin;
+        statistics.LastStage = worker->End;
+        statistics.Cost = worker->Cost;
+        statistics.Tiles = static_cast<size_t>(worker->Tiles.load(std::memory_order_relaxed));
+        statistics.BusySeconds =
+            static_cast<double>(worker->BusyNanoseconds.load(std::memory_order_relaxed)) * 1e-9;
+        statistics.Utilization = seconds > 0.0 ? statistics.BusySeconds / seconds : 0.0;
+        result.push_back(statistics);
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：WorkerLoop
+// 功能：工作线程主循环：从输入队列取槽，计算本级阶段区间，交给下一级；
+//       最后一级写出输出后把槽放入完成队列
+// 入口参数：size_t Index 流水级索引
+// 出口参数：无
+// 返回值：无
+void PipelineExecutor::WorkerLoop(size_t Index) {
+    Worker& worker = *m_Workers[Index];
+    const bool last = Index + 1 == m_Workers.size();
+    SpscRing<Slot*>& next = last ? *m_Done : *m_Workers[Index + 1]->Input;
+    size_t spins{0};
+    while (!m_Stop.load(std::memory_order_acquire)) {
+        Slot* slot{nullptr};
+        const uint64_t epoch = m_Epoch.load(std::memory_order_seq_cst);
+        if (!worker.Input->TryPop(slot)) {
+            Wait(spins, epoch);
+            continue;
+        }
+        Notify();
+        spins = 0;
+        const Clock::time_point begin = Clock::now();
+        m_Plan.ForwardStages(worker.Begin, worker.End, slot->Values.data(),
+                             CompiledNetwork::BATCH_TILE, slot->Tile);
+        if (last) {
+            m_Plan.StoreOutputs(slot->Values.data(), CompiledNetwork::BATCH_TILE,
+                                slot->Tile, slot->Out);
+        }
+        const auto busy = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - begin).count();
+        worker.BusyNanoseconds.fetch_add(static_cast<uint64_t>(busy), std::memory_order_relaxed);
+        worker.Tiles.fetch_add(1, std::memory_order_relaxed);
+        // 下一级队列容量不小于槽数，不会写满
+        while (!next.TryPush(slot)) {
+            std::this_thread::yield();
+        }
+        Notify();
+    }
+}
+
+// 函数名：Partition
+// 功能：线性划分：best[j][i]为把前i个阶段分为j段时的最小最大段计算量，
+//       best[j][i] = min_p max(best[j-1][p], cost(p, i))，再回溯得到分界点
+// 入口参数：size_t Parts 段数（不超过阶段数）
+// 出口参数：无
+// 返回值：std::vector<size_t> Parts+1个分界点，第p段为[bounds[p], bounds[p+1])
+std::vector<size_t> PipelineExecutor::Partition(size_t Parts) const {
+    const size_t n = m_Plan.GetStageCount();
+    std::vector<size_t> prefix(n + 1, 0);
+    for (size_t s = 0; s < n; ++s) {
+        prefix[s + 1] = prefix[s] + m_Plan.GetStageCost(s);
+    }
+    std::vector<size_t> bounds(Parts + 1, 0);
+    bounds[Parts] = n;
+    if (Parts <= 1 || n == 0) {
+        return bounds;
+    }
+    const size_t INF = std::numeric_limits<size_t>::max();
+    std::vector<std::vector<size_t>> best(Parts + 1, std::vector<size_t>(n + 1, INF));
+    std::vector<std::vector<size_t>> cut(Parts + 1, std::vector<size_t>(n + 1, 0));
+    for (size_t i = 1; i <= n; ++i) {
+        best[1][i] = prefix[i];
+    }
+    for (size_t j = 2; j <= Parts; ++j) {
+        for (size_t i = j; i <= n; ++i) {
+            for (size_t p = j - 1; p < i; ++p) {
+                const size_t cost = std::max(best[j - 1][p], prefix[i] - prefix[p]);
+                if (cost < best[j][i]) {
+                    best[j][i] = cost;
+                    cut[j][i] = p;
+                }
+            }
+        }
+    }
+    size_t end = n;
+    for (size_t j = Parts; j >= 2; --j) {
+        end = cut[j][end];
+        bounds[j - 1] = end;
+    }
+    return bounds;
+}
+
+// 函数名：Wait
+// 功能：等待一次。前SPIN_LIMIT次让出时间片；之后登记为阻塞线程，在条件变量上
+//       等待事件计数不等于Epoch（调用者在尝试出入队前读取）或停止。
+//       登记与Notify的递增计数均为顺序一致操作，二者至少有一方看到对方，不会丢失唤醒
+// 入口参数：size_t& Spins 连续等待次数, uint64_t Epoch 尝试前读取的事件计数
+// 出口参数：size_t& Spins 未超过SPIN_LIMIT时加1
+// 返回值：无
+void PipelineExecutor::Wait(size_t& Spins, uint64_t Epoch) {
+    if (Spins < SPIN_LIMIT) {
+        ++Spins;
+        std::this_thread::yield();
+        return;
+    }
+    m_Sleepers.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_Wake.wait(lock, [this, Epoch]() {
+            return m_Epoch.load(std::memory_order_seq_cst) != Epoch
+                || m_Stop.load(std::memory_order_acquire);
+        });
+    }
+    m_Sleepers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// 函数名：Notify
+// 功能：递增事件计数；有阻塞的线程时在互斥量保护下唤醒全部等待者
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void PipelineExecutor::Notify() {
+    m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_Sleepers.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_Wake.notify_all();
+    }
+}
+
+// 函数名：PinThread（静态）
+// 功能：将线程绑定到指定核心，失败时保持不绑定
+// 入口参数：std::thread& AThread, size_t Core 核心编号
+// 出口参数：无
+// 返回值：无
+void PipelineExecutor::PinThread(std::thread& AThread, size_t Core) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(Core, &set);
+    pthread_setaffinity_np(AThread.native_handle(), sizeof(set), &set);
+#else
+    (void)AThread;
+    (void)Core;
+#endif
+}
@@ -0,0 +1,191 @@
+//
+//  PipelineExecutor.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】PipelineExecutor.hpp
+//【功能模块和目的】流水线并行执行器类声明：把编译计划的连续阶段区间分给
+//       不同的工作线程，样本块在线程间依次传递，吞吐量随网络深度扩展
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//            2026/10/18 绑定核心改为可选，持续空闲时在条件变量上等待
+//------------------------------------------------------------------------------
+
+#ifndef PipelineExecutor_hpp
+#define PipelineExecutor_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//uint64_t所属头文件
+#include <cstdint>
+//std::vector所属头文件
+#include <vector>
+//std::unique_ptr所属头文件
+#include <memory>
+//std::thread所属头文件
+#include <thread>
+//std::atomic所属头文件
+#include <atomic>
+//std::mutex所属头文件
+#include <mutex>
+//std::condition_variable所属头文件
+#include <condition_variable>
+//std::chrono所属头文件
+#include <chrono>
+//Network类所属头文件
+#include "Network.hpp"
+//CompiledNetwork类所属头文件
+#include "CompiledNetwork.hpp"
+//SpscRing类模版所属头文件
+#include "SpscRing.hpp"
+
+//------------------------------------------------------------------------------
+//【类名】PipelineExecutor
+//【功能】流水线并行执行器。构造时把网络编译为double计划（使用网络设置的激活近似方式），
+//       按各阶段（拓扑层级，分层网络中即为一层）的估算计算量，用动态规划把阶段序列
+//       划分为至多StageCount个连续区间，使最大区间计算量最小；每个区间由一个
+//       工作线程负责（可选在Linux下绑定到固定核心，默认不绑定，遵从进程的CPU亲和性）。
+//       样本按CompiledNetwork::BATCH_TILE分块，每块占用一个槽（神经元×样本的中间结果缓冲）：
+//       调用线程写入输入后把槽交给第一个工作线程，各工作线程计算自己的区间后经
+//       无锁单生产者单消费者环形队列交给下一个线程，最后一个线程写出输出后把槽还给调用线程。
+//       不同的块同时处于不同区间，稳定流量下各核心并行工作。
+//       等待队列时先让出时间片，连续SPIN_LIMIT次仍无进展后在条件变量上阻塞，
+//       由队列的下一次入队或出队唤醒，空闲时不占用核心。
+//       记录每个流水级的处理块数、忙碌时间与利用率，用于调整划分
+//【接口说明】
+//    以网络、流水级数、是否绑定核心为参数构造，网络不合理时抛出std::runtime_error
+//    禁止拷贝构造、赋值
+//    析构时停止并回收全部工作线程
+//    批量推理（多个线程调用时依次执行）
+//    获取流水级数、各流水级统计，清零统计
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】2026/10/18 Pin默认关闭；Backoff改为Wait/Notify，超过自旋次数后阻塞等待
+//------------------------------------------------------------------------------
+class PipelineExecutor {
+public:
+    //--------------------------------------------------------------------------
+    //与数据交换相关的内嵌类
+    //--------------------------------------------------------------------------
+    // 流水级统计
+    class StageStatistics {
+    public:
+        // 负责的计划阶段区间[FirstStage, LastStage)
+        size_t FirstStage{0};
+        size_t LastStage{0};
+        // 区间估算计算量（单样本乘加次数）
+        size_t Cost{0};
+        // 已处理的样本块数
+        size_t Tiles{0};
+        // 计算耗时（秒）
+        double BusySeconds{0.0};
+        // 利用率：计算耗时 / 自构造或清零统计以来的时间
+        double Utilization{0.0};
+    };
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 以网络、流水级数（0视为1，超过阶段数时取阶段数）、是否绑定核心为参数构造；
+    // 绑定时第p级固定在核心(p+1)%核心数上，会忽略进程的CPU亲和性设置，需显式开启
+    explicit PipelineExecutor(const Network& ANetwork, size_t StageCount, bool Pin = false);
+    // 禁止拷贝构造
+    PipelineExecutor(const PipelineExecutor&) = delete;
+    // 禁止赋值
+    PipelineExecutor& operator=(const PipelineExecutor&) = delete;
+    // 虚析构函数，停止并回收工作线程
+    virtual ~PipelineExecutor();
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 批量推理，in为batch行×输入数的行主序矩阵，out为batch行×输出数的行主序矩阵
+    void InferenceBatch(const double* in, size_t batch, double* out);
+    // 清零统计
+    void ResetStatistics();
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取流水级数
+    size_t GetStageCount() const;
+    // 获取各流水级统计
+    std::vector<StageStatistics> GetStatistics() const;
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 等待时让出时间片的次数，超过后在条件变量上阻塞
+    static constexpr size_t SPIN_LIMIT{256};
+private:
+    //--------------------------------------------------------------------------
+    //私有内嵌类
+    //--------------------------------------------------------------------------
+    // 计时使用的时钟
+    using Clock = std::chrono::steady_clock;
+    // 样本块槽
+    class Slot {
+    public:
+        // 神经元×样本的中间结果，行长度为BATCH_TILE
+        std::vector<double> Values;
+        // 有效样本数
+        size_t Tile{0};
+        // 输出矩阵中本块的起始位置
+        double* Out{nullptr};
+    };
+    // 流水级
+    class Worker {
+    public:
+        // 负责的计划阶段区间[Begin, End)
+        size_t Begin{0};
+        size_t End{0};
+        // 区间估算计算量
+        size_t Cost{0};
+        // 输入队列（由上一级或调用线程写入）
+        std::unique_ptr<SpscRing<Slot*>> Input;
+        // 已处理的样本块数
+        std::atomic<uint64_t> Tiles{0};
+        // 计算耗时（纳秒）
+        std::atomic<uint64_t> BusyNanoseconds{0};
+        // 工作线程
+        std::thread Thread;
+    };
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 工作线程主循环
+    void WorkerLoop(size_t Index);
+    // 按阶段计算量把阶段序列划分为Parts个连续区间，返回各区间的起点（末尾附阶段总数）
+    std::vector<size_t> Partition(size_t Parts) const;
+    // 等待一次：先让出时间片，连续等待SPIN_LIMIT次后阻塞到队列事件计数不等于Epoch
+    void Wait(size_t& Spins, uint64_t Epoch);
+    // 队列状态变化后递增事件计数，有阻塞的线程时将其唤醒
+    void Notify();
+    // 将工作线程绑定到指定核心（仅Linux，其他平台不绑定）
+    static void PinThread(std::thread& AThread, size_t Core);
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 编译计划（double精度）
+    CompiledNetwork m_Plan;
+    // 流水级
+    std::vector<std::unique_ptr<Worker>> m_Workers;
+    // 完成队列：最后一级把处理完的槽还给调用线程
+    std::unique_ptr<SpscRing<Slot*>> m_Done;
+    // 样本块槽
+    std::vector<Slot> m_Slots;
+    // 是否停止
+    std::atomic<bool> m_Stop{false};
+    // 队列事件计数：每次入队、出队后递增，等待方在尝试前读取
+    std::atomic<uint64_t> m_Epoch{0};
+    // 在条件变量上阻塞的线程数
+    std::atomic<size_t> m_Sleepers{0};
+    // 保护阻塞等待
+    std::mutex m_WakeMutex;
+    // 阻塞等待的条件变量
+    std::condition_variable m_Wake;
+    // 串行化InferenceBatch（调用线程是第一级的唯一生产者）
+    std::mutex m_BatchMutex;
+    // 统计起始时刻
+    std::atomic<Clock::rep> m_StatisticsStart;
+};
+//------------------------------------------------------------------------------
+
+#endif /* PipelineExecutor_hpp */
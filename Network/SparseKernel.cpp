@@ -0,0 +1,230 @@
+//
+//  SparseKernel.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】SparseKernel.cpp
+//【功能模块和目的】稀疏连接层CSR矩阵计算内核实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】2026/10/18 增加跳过零值源的散射形式内核
+//            2026/10/18 gather改用全1掩码与零初值的掩码形式，消除未初始化告警
+//------------------------------------------------------------------------------
+
+// SparseKernel类所属头文件
+#include "SparseKernel.hpp"
+// std::min所属头文件
+#include <algorithm>
+
+#if defined(__AVX2__)
+// x86向量指令内建函数所属头文件
+#include <immintrin.h>
+#endif
+
+//------------------------------------------------------------------------------
+//内部实现：与精度无关的标量部分
+//------------------------------------------------------------------------------
+
+// 函数名：RowDot
+// 功能：计算CSR一行在[begin, end)上的稀疏点积，四路累加以隐藏加法延迟
+// 入口参数：const T* weight, const uint32_t* index, size_t begin, size_t end, const T* x
+// 出口参数：无
+// 返回值：T 点积
+template<class T>
+static T RowDot(const T* weight, const uint32_t* index,
+                size_t begin, size_t end, const T* x) {
+    T acc[4] = {};
+    size_t k = begin;
+    for (; k + 4 <= end; k += 4) {
+        acc[0] += weight[k] * x[index[k]];
+        acc[1] += weight[k + 1] * x[index[k + 1]];
+        acc[2] += weight[k + 2] * x[index[k + 2]];
+        acc[3] += weight[k + 3] * x[index[k + 3]];
+    }
+    for (; k < end; ++k) {
+        acc[0] += weight[k] * x[index[k]];
+    }
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+// 函数名：RowsMM
+// 功能：稀疏矩阵-矩阵乘法，每个非零权重沿样本方向连续累加（编译器可自动向量化）
+// 入口参数：const T* weight, const uint32_t* index, const size_t* rowStart,
+//           size_t rows, const T* X, size_t ld, size_t n
+// 出口参数：T* Y
+// 返回值：无
+template<class T>
+static void RowsMM(const T* weight, const uint32_t* index, const size_t* rowStart,
+                   size_t rows, const T* X, size_t ld, T* Y, size_t n) {
+    for (size_t i = 0; i < rows; ++i) {
+        T* acc = Y + i * ld;
+        for (size_t k = rowStart[i]; k < rowStart[i + 1]; ++k) {
+            const T w = weight[k];
+            const T* src = X + index[k] * ld;
+            for (size_t b = 0; b < n; ++b) {
+                acc[b] += w * src[b];
+            }
+        }
+    }
+}
+
+// 函数名：ScatterColumns
+// 功能：散射形式乘法。每SCATTER_BLOCK个源先无分支地压缩出非零源的索引列表，
+//       再逐个非零源把出边权重乘以源值累加到目标；稠密列且ld为1时目标连续，
+//       编译器可自动向量化
+// 入口参数：const T* weight, const uint32_t* target, const size_t* colStart,
+//           size_t cols, const T* x, size_t ld
+// 出口参数：T* y
+// 返回值：size_t 非零源数
+template<class T>
+static size_t ScatterColumns(const T* weight, const uint32_t* target, const size_t* colStart,
+                             size_t cols, const T* x, size_t ld, T* y) {
+    uint32_t active[SparseKernel::SCATTER_BLOCK];
+    size_t total = 0;
+    for (size_t first = 0; first < cols; first += SparseKernel::SCATTER_BLOCK) {
+        const size_t last = std::min(cols, first + SparseKernel::SCATTER_BLOCK);
+        size_t count = 0;
+        for (size_t j = first; j < last; ++j) {
+            active[count] = static_cast<uint32_t>(j);
+            count += x[j * ld] != T(0) ? 1 : 0;
+        }
+        for (size_t a = 0; a < count; ++a) {
+            const size_t j = active[a];
+            const T value = x[j * ld];
+            const T* w = weight + colStart[j];
+            const size_t n = colStart[j + 1] - colStart[j];
+            if (target != nullptr) {
+                const uint32_t* t = target + colStart[j];
+                for (size_t k = 0; k < n; ++k) {
+                    y[t[k] * ld] += w[k] * value;
+                }
+            } else if (ld == 1) {
+                for (size_t k = 0; k < n; ++k) {
+                    y[k] += w[k] * value;
+                }
+            } else {
+                for (size_t k = 0; k < n; ++k) {
+                    y[k * ld] += w[k] * value;
+                }
+            }
+        }
+        total += count;
+    }
+    return total;
+}
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：SpMV（静态）
+// 功能：double稀疏矩阵-向量乘法并累加到y。AVX2下每次以gather取4个源值
+// 入口参数：const double* weight, const uint32_t* index, const size_t* rowStart,
+//           size_t rows, const double* x
+// 出口参数：double* y
+// 返回值：无
+void SparseKernel::SpMV(const double* weight, const uint32_t* index, const size_t* rowStart,
+                        size_t rows, const double* x, double* y) {
+    for (size_t i = 0; i < rows; ++i) {
+        size_t k = rowStart[i];
+        const size_t end = rowStart[i + 1];
+#if defined(__AVX2__)
+        __m256d acc = _mm256_setzero_pd();
+        // 非掩码gather的目的寄存器在GCC中未初始化，-Wmaybe-uninitialized会告警
+        const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        for (; k + 4 <= end; k += 4) {
+            __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(index + k));
+            __m256d src = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, idx, all, sizeof(double));
+            acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(weight + k), src));
+        }
+        __m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+        y[i] += _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+#endif
+        y[i] += RowDot(weight, index, k, end, x);
+    }
+}
+
+// 函数名：SpMV（静态）
+// 功能：float稀疏矩阵-向量乘法并累加到y。AVX2下每次以gather取8个源值
+// 入口参数：const float* weight, const uint32_t* index, const size_t* rowStart,
+//           size_t rows, const float* x
+// 出口参数：float* y
+// 返回值：无
+void SparseKernel::SpMV(const float* weight, const uint32_t* index, const size_t* rowStart,
+                        size_t rows, const float* x, float* y) {
+    for (size_t i = 0; i < rows; ++i) {
+        size_t k = rowStart[i];
+        const size_t end = rowStart[i + 1];
+#if defined(__AVX2__)
+        __m256 acc = _mm256_setzero_ps();
+        const __m256 all = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (; k + 8 <= end; k += 8) {
+            __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index + k));
+            __m256 src = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), x, idx, all, sizeof(float));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(weight + k), src));
+        }
+        __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+        y[i] += _mm_cvtss_f32(_mm_add_ss(half, _mm_movehdup_ps(half)));
+#endif
+        y[i] += RowDot(weight, index, k, end, x);
+    }
+}
+
+// 函数名：SpMM（静态）
+// 功能：double稀疏矩阵-矩阵乘法并累加到Y
+// 入口参数：const double* weight, const uint32_t* index, const size_t* rowStart,
+//           size_t rows, const double* X, size_t ld, size_t n
+// 出口参数：double* Y
+// 返回值：无
+void SparseKernel::SpMM(const double* weight, const uint32_t* index, const size_t* rowStart,
+                        size_t rows, const double* X, size_t ld, double* Y, size_t n) {
+    RowsMM(weight, index, rowStart, rows, X, ld, Y, n);
+}
+
+// 函数名：SpMM（静态）
+// 功能：float稀疏矩阵-矩阵乘法并累加到Y
+// 入口参数：const float* weight, const uint32_t* index, const size_t* rowStart,
+//           size_t rows, const float* X, size_t ld, size_t n
+// 出口参数：float* Y
+// 返回值：无
+void SparseKernel::SpMM(const float* weight, const uint32_t* index, const size_t* rowStart,
+                        size_t rows, const float* X, size_t ld, float* Y, size_t n) {
+    RowsMM(weight, index, rowStart, rows, X, ld, Y, n);
+}
+
+// 函数名：Scatter（静态）
+// 功能：double散射形式乘法，只计算非零源的出边并累加到y
+// 入口参数：const double* weight, const uint32_t* target 目标索引（稠密列时为nullptr）,
+//           const size_t* colStart, size_t cols, const double* x, size_t ld
+// 出口参数：double* y
+// 返回值：size_t 非零源数
+size_t SparseKernel::Scatter(const double* weight, const uint32_t* target, const size_t* colStart,
+                             size_t cols, const double* x, size_t ld, double* y) {
+    return ScatterColumns(weight, target, colStart, cols, x, ld, y);
+}
+
+// 函数名：Scatter（静态）
+// 功能：float散射形式乘法，只计算非零源的出边并累加到y
+// 入口参数：const float* weight, const uint32_t* target 目标索引（稠密列时为nullptr）,
+//           const size_t* colStart, size_t cols, const float* x, size_t ld
+// 出口参数：float* y
+// 返回值：size_t 非零源数
+size_t SparseKernel::Scatter(const float* weight, const uint32_t* target, const size_t* colStart,
+                             size_t cols, const float* x, size_t ld, float* y) {
+    return ScatterColumns(weight, target, colStart, cols, x, ld, y);
+}
+
+// 函数名：GetPath（静态）
+// 功能：获取当前编译目标使用的指令集路径名称
+// 入口参数：无
+// 出口参数：无
+// 返回值：const char* 路径名称
+const char* SparseKernel::GetPath() {
+#if defined(__AVX2__)
+    return "AVX2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,68 @@
+//
+//  SparseKernel.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】SparseKernel.hpp
+//【功能模块和目的】稀疏连接层CSR矩阵计算内核声明
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】2026/10/18 增加跳过零值源的散射形式内核
+//------------------------------------------------------------------------------
+
+#ifndef SparseKernel_hpp
+#define SparseKernel_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//uint32_t所属头文件
+#include <cstdint>
+
+//------------------------------------------------------------------------------
+//【类名】SparseKernel
+//【功能】CSR格式稀疏矩阵内核。每行的非零权重与32位源索引连续存放，
+//       rowStart给出各行在权重、索引数组中的起止位置。单样本时AVX2下以
+//       gather指令按索引取源值，批量时对每个非零权重沿样本方向连续累加。
+//       散射形式按源列（CSC或列主序稠密）存放权重：先把值非零的源压缩为索引列表，
+//       再只把这些源的出边权重累加到目标，计算量与非零源数成正比
+//【接口说明】
+//    静态：稀疏矩阵-向量乘法（累加到输出），double与float两种精度
+//    静态：稀疏矩阵-矩阵乘法（累加到输出），double与float两种精度
+//    静态：跳过零值源的散射形式乘法（累加到输出），double与float两种精度
+//    静态：当前编译目标使用的指令集路径名称
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】2026/10/18 增加散射形式乘法
+//------------------------------------------------------------------------------
+class SparseKernel {
+public:
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    // y[i] += Σk weight[k] × x[index[k]]，k∈[rowStart[i], rowStart[i+1])，i∈[0, rows)
+    static void SpMV(const double* weight, const uint32_t* index, const size_t* rowStart,
+                     size_t rows, const double* x, double* y);
+    static void SpMV(const float* weight, const uint32_t* index, const size_t* rowStart,
+                     size_t rows, const float* x, float* y);
+    // Y[i][0..n) += Σk weight[k] × X[index[k]][0..n)，X、Y行间距均为ld
+    static void SpMM(const double* weight, const uint32_t* index, const size_t* rowStart,
+                     size_t rows, const double* X, size_t ld, double* Y, size_t n);
+    static void SpMM(const float* weight, const uint32_t* index, const size_t* rowStart,
+                     size_t rows, const float* X, size_t ld, float* Y, size_t n);
+    // 对x[j]≠0的源j：y[target[k]] += weight[k] × x[j]，k∈[colStart[j], colStart[j+1])，j∈[0, cols)；
+    // target为nullptr时各列为稠密列，目标为k - colStart[j]。x、y元素间距均为ld，返回非零源数
+    static size_t Scatter(const double* weight, const uint32_t* target, const size_t* colStart,
+                          size_t cols, const double* x, size_t ld, double* y);
+    static size_t Scatter(const float* weight, const uint32_t* target, const size_t* colStart,
+                          size_t cols, const float* x, size_t ld, float* y);
+    // 当前编译目标使用的指令集路径名称（"AVX2"或"scalar"）
+    static const char* GetPath();
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 散射形式每次压缩的源数（索引列表放在栈上）
+    static constexpr size_t SCATTER_BLOCK{256};
+};
+//------------------------------------------------------------------------------
+
+#endif /* SparseKernel_hpp */
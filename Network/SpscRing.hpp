@@ -0,0 +1,155 @@
+//
+//  SpscRing.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】SpscRing.hpp
+//【功能模块和目的】单生产者单消费者无锁环形队列类模版声明与实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef SpscRing_hpp
+#define SpscRing_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::atomic所属头文件
+#include <atomic>
+
+//------------------------------------------------------------------------------
+//【类模版名】SpscRing
+//【功能】固定容量的单生产者单消费者无锁环形队列，T为元素类型（通常为指针）。
+//       容量向上取整为2的幂；写位置只由生产者修改、读位置只由消费者修改，
+//       以acquire/release顺序发布元素，两个位置分处不同缓存行避免伪共享
+//【接口说明】
+//    以最小容量为参数构造
+//    禁止拷贝构造、赋值
+//    生产者：尝试写入，队列满时返回false
+//    消费者：尝试读取，队列空时返回false
+//    获取容量
+//【特殊使用说明】同一时刻只能有一个线程调用TryPush、一个线程调用TryPop
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+template<class T>
+class SpscRing {
+public:
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 以最小容量为参数构造，容量向上取整为2的幂（至少为2）
+    explicit SpscRing(size_t Capacity);
+    // 禁止拷贝构造
+    SpscRing(const SpscRing&) = delete;
+    // 禁止赋值
+    SpscRing& operator=(const SpscRing&) = delete;
+    // 虚析构函数，默认实现
+    virtual ~SpscRing() = default;
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 生产者：尝试写入一个元素，队列满时返回false
+    bool TryPush(const T& Value);
+    // 消费者：尝试读取一个元素，队列空时返回false
+    bool TryPop(T& Value);
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取容量
+    size_t GetCapacity() const;
+private:
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 缓存行大小
+    static constexpr size_t CACHE_LINE{64};
+    // 元素存储
+    std::vector<T> m_Slots;
+    // 容量减1，用于取模
+    size_t m_Mask;
+    // 写位置（只增不减），仅生产者修改
+    alignas(CACHE_LINE) std::atomic<size_t> m_Head{0};
+    // 读位置（只增不减），仅消费者修改
+    alignas(CACHE_LINE) std::atomic<size_t> m_Tail{0};
+};
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+//函数名：SpscRing
+//功能：构造函数，容量向上取整为2的幂
+//入口参数：size_t Capacity 最小容量
+//出口参数：无
+//返回值：无
+template<class T>
+SpscRing<T>::SpscRing(size_t Capacity) {
+    size_t size = 2;
+    while (size < Capacity) {
+        size <<= 1;
+    }
+    m_Slots.resize(size);
+    m_Mask = size - 1;
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+//函数名：TryPush
+//功能：生产者写入一个元素。先写元素，再以release发布新的写位置
+//入口参数：const T& Value
+//出口参数：无
+//返回值：bool 队列满时为false
+template<class T>
+bool SpscRing<T>::TryPush(const T& Value) {
+    const size_t head = m_Head.load(std::memory_order_relaxed);
+    if (head - m_Tail.load(std::memory_order_acquire) > m_Mask) {
+        return false;
+    }
+    m_Slots[head & m_Mask] = Value;
+    m_Head.store(head + 1, std::memory_order_release);
+    return true;
+}
+//------------------------------------------------------------------------------
+
+//函数名：TryPop
+//功能：消费者读取一个元素。以acquire读取写位置后取元素，再以release发布新的读位置
+//入口参数：无
+//出口参数：T& Value
+//返回值：bool 队列空时为false
+template<class T>
+bool SpscRing<T>::TryPop(T& Value) {
+    const size_t tail = m_Tail.load(std::memory_order_relaxed);
+    if (tail == m_Head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    Value = m_Slots[tail & m_Mask];
+    m_Tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+//函数名：GetCapacity
+//功能：获取容量
+//入口参数：无
+//出口参数：无
+//返回值：size_t 容量
+template<class T>
+size_t SpscRing<T>::GetCapacity() const {
+    return m_Mask + 1;
+}
+//------------------------------------------------------------------------------
+
+#endif /* SpscRing_hpp */
@@ -8,6 +8,7 @@
 //【文件名】StaticContainer.hpp
 //【功能模块和目的】静态容器类模版定义及实现，用于存储不同数据类型元素、长度固定的容器类模版
 //【开发者及日期】孙李智 2025/7/12
+//【更改记录】2026/10/17 拷贝构造、赋值改为constexpr，可用于常量求值（C++20）
 //------------------------------------------------------------------------------
 
 #ifndef StaticContainer_hpp
@@ -48,9 +49,9 @@ public:
     //拷贝构造函数
     //派生类的拷贝构造函数时，可以在初始化列表中显示调用基类的拷贝构造函数
     //如果不在初始化列表中调用基类的拷贝构造函数，则会默认调用基类默认构造函数
-    inline StaticContainer(const StaticContainer& Source);
+    constexpr StaticContainer(const StaticContainer& Source);
     //赋值运算符overload，因需手动调用基类赋值运算符，不可默认实现
-    inline StaticContainer& operator=(const StaticContainer& Source);
+    constexpr StaticContainer& operator=(const StaticContainer& Source);
     //虚析构函数，因可为基类，声明为虚；因无成员动态构造，默认实现
     inline virtual ~StaticContainer() = default;
     //--------------------------------------------------------------------------
@@ -70,7 +71,7 @@ public:
 //出口参数：无
 //返回值：无
 template<class ET, size_t N>
-StaticContainer<ET, N>::StaticContainer(const StaticContainer& Source)
+constexpr StaticContainer<ET, N>::StaticContainer(const StaticContainer& Source)
 : Container<ET, std::array<ET, N>>(Source) {
 }
 //------------------------------------------------------------------------------
@@ -81,7 +82,7 @@ StaticContainer<ET, N>::StaticContainer(const StaticContainer& Source)
 //出口参数：无
 //返回值：静态容器自身的引用
 template<class ET, size_t N>
-StaticContainer<ET, N>& StaticContainer<ET, N>::operator=(
+constexpr StaticContainer<ET, N>& StaticContainer<ET, N>::operator=(
 const StaticContainer<ET, N>& Source) {
     if (this != &Source) {
         //手动调用基类赋值运算符
@@ -0,0 +1,275 @@
+//
+//  StreamInference.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】StreamInference.cpp
+//【功能模块和目的】流式批量推理类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+// StreamInference类所属头文件
+#include "StreamInference.hpp"
+// 异常基类所属头文件
+#include <stdexcept>
+// std::from_chars、std::to_chars所属头文件
+#include <charconv>
+// std::memcpy所属头文件
+#include <cstring>
+// uint16_t所属头文件
+#include <cstdint>
+// std::reverse、std::max、std::transform所属头文件
+#include <algorithm>
+// std::tolower所属头文件
+#include <cctype>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：StreamInference
+// 功能：以网络和批大小为参数构造，预先分配一批样本的输入、输出矩阵
+// 入口参数：const Network& ANetwork, size_t BatchSize 批大小，0视为1
+// 出口参数：无
+// 返回值：无，网络不合理时抛出std::runtime_error
+StreamInference::StreamInference(const Network& ANetwork, size_t BatchSize)
+    : m_Network(ANetwork),
+      m_BatchSize(std::max<size_t>(BatchSize, 1)),
+      m_InputCount(ANetwork.GetInputMarker().size()),
+      m_OutputCount(ANetwork.GetOutputMarker().size()) {
+    if (!ANetwork.IsValid()) {
+        throw std::runtime_error("Network is not valid");
+    }
+    m_Input.resize(m_BatchSize * m_InputCount);
+    m_Output.resize(m_BatchSize * m_OutputCount);
+}
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：Run
+// 功能：读完输入流为止，逐批读取样本、批量推理并写出结果
+// 入口参数：std::istream& Input, FORMAT InputFormat 输入流及其格式
+//          FORMAT OutputFormat 输出格式
+// 出口参数：std::ostream& Output 输出流
+// 返回值：size_t 处理的样本数，输入格式错误或写出失败时抛出std::runtime_error
+size_t StreamInference::Run(std::istream& Input, FORMAT InputFormat,
+                            std::ostream& Output, FORMAT OutputFormat) {
+    m_LineNumber = 0;
+    size_t total{0};
+    while (true) {
+        size_t rows{0};
+        switch (InputFormat) {
+            case FORMAT::CSV:
+                rows = ReadCsv(Input);
+                break;
+            case FORMAT::FLOAT32:
+                rows = ReadBinary<float>(Input);
+                break;
+            case FORMAT::FLOAT64:
+                rows = ReadBinary<double>(Input);
+                break;
+        }
+        if (rows == 0) {
+            break;
+        }
+        m_Network.InferenceBatch(m_Input.data(), rows, m_Output.data());
+        switch (OutputFormat) {
+            case FORMAT::CSV:
+                WriteCsv(Output, rows);
+                break;
+            case FORMAT::FLOAT32:
+                WriteBinary<float>(Output, rows);
+                break;
+            case FORMAT::FLOAT64:
+                WriteBinary<double>(Output, rows);
+                break;
+        }
+        if (!Output) {
+            throw std::runtime_error("Failed to write inference output");
+        }
+        total += rows;
+    }
+    Output.flush();
+    return total;
+}
+
+//------------------------------------------------------------------------------
+//静态成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：ParseFormat（静态）
+// 功能：由名称得到数据格式，不区分大小写
+// 入口参数：const std::string& Name csv、f32（float32）或f64（float64、double）
+// 出口参数：无
+// 返回值：FORMAT，未知名称抛出std::invalid_argument
+StreamInference::FORMAT StreamInference::ParseFormat(const std::string& Name) {
+    std::string lower = Name;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+    if (lower == "csv") {
+        return FORMAT::CSV;
+    }
+    if (lower == "f32" || lower == "float32" || lower == "float") {
+        return FORMAT::FLOAT32;
+    }
+    if (lower == "f64" || lower == "float64" || lower == "double") {
+        return FORMAT::FLOAT64;
+    }
+    throw std::invalid_argument("Unknown data format: " + Name);
+}
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：ReadCsv
+// 功能：逐行读取至多一批样本。数值用std::from_chars解析（不受locale影响），
+//       分隔符前后允许空格、制表符，行尾'\r'忽略
+// 入口参数：std::istream& Input
+// 出口参数：无
+// 返回值：size_t 读取的样本数，列数不符或数值非法时抛出std::runtime_error
+size_t StreamInference::ReadCsv(std::istream& Input) {
+    size_t rows{0};
+    while (rows < m_BatchSize && std::getline(Input, m_Line)) {
+        ++m_LineNumber;
+        const char* p = m_Line.data();
+        const char* end = p + m_Line.size();
+        auto skipBlank = [&p, end]() {
+            while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+                ++p;
+            }
+        };
+        skipBlank();
+        if (p == end || *p == '#') {
+            continue;
+        }
+        double* row = m_Input.data() + rows * m_InputCount;
+        size_t column{0};
+        while (true) {
+            skipBlank();
+            if (p < end && *p == '+') {
+                ++p;
+            }
+            double value{0.0};
+            auto result = std::from_chars(p, end, value);
+            if (result.ec != std::errc() || column >= m_InputCount) {
+                throw std::runtime_error("Invalid CSV input at line "
+                                         + std::to_string(m_LineNumber));
+            }
+            row[column++] = value;
+            p = result.ptr;
+            skipBlank();
+            if (p == end) {
+                break;
+            }
+            if (*p != ',') {
+                throw std::runtime_error("Invalid CSV input at line "
+                                         + std::to_string(m_LineNumber));
+            }
+            ++p;
+        }
+        if (column != m_InputCount) {
+            throw std::runtime_error("Expected " + std::to_string(m_InputCount)
+                                     + " values at line " + std::to_string(m_LineNumber));
+        }
+        ++rows;
+    }
+    return rows;
+}
+
+// 函数名：ReadBinary
+// 功能：一次读取至多一批样本的字节，转换为double输入矩阵
+// 入口参数：std::istream& Input
+// 出口参数：无
+// 返回值：size_t 读取的样本数，末尾不足一个样本时抛出std::runtime_error
+template <typename T>
+size_t StreamInference::ReadBinary(std::istream& Input) {
+    const size_t rowBytes = m_InputCount * sizeof(T);
+    m_Bytes.resize(m_BatchSize * rowBytes);
+    Input.read(m_Bytes.data(), static_cast<std::streamsize>(m_Bytes.size()));
+    const size_t bytes = static_cast<size_t>(Input.gcount());
+    if (bytes % rowBytes != 0) {
+        throw std::runtime_error("Truncated binary input: trailing "
+                                 + std::to_string(bytes % rowBytes) + " bytes");
+    }
+    const size_t count = bytes / sizeof(T);
+    if (!IsLittleEndian()) {
+        SwapBytes(m_Bytes.data(), count, sizeof(T));
+    }
+    for (size_t i = 0; i < count; ++i) {
+        T value;
+        std::memcpy(&value, m_Bytes.data() + i * sizeof(T), sizeof(T));
+        m_Input[i] = static_cast<double>(value);
+    }
+    return bytes / rowBytes;
+}
+
+// 函数名：WriteCsv
+// 功能：把Rows个样本的结果格式化到缓冲区后一次写出，
+//       数值使用std::to_chars的最短可往返表示
+// 入口参数：size_t Rows
+// 出口参数：std::ostream& Output
+// 返回值：无
+void StreamInference::WriteCsv(std::ostream& Output, size_t Rows) {
+    m_Text.clear();
+    char buffer[32];
+    for (size_t r = 0; r < Rows; ++r) {
+        const double* row = m_Output.data() + r * m_OutputCount;
+        for (size_t c = 0; c < m_OutputCount; ++c) {
+            if (c != 0) {
+                m_Text.push_back(',');
+            }
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), row[c]);
+            m_Text.append(buffer, result.ptr);
+        }
+        m_Text.push_back('\n');
+    }
+    Output.write(m_Text.data(), static_cast<std::streamsize>(m_Text.size()));
+}
+
+// 函数名：WriteBinary
+// 功能：把Rows个样本的结果转换为T后按小端一次写出
+// 入口参数：size_t Rows
+// 出口参数：std::ostream& Output
+// 返回值：无
+template <typename T>
+void StreamInference::WriteBinary(std::ostream& Output, size_t Rows) {
+    const size_t count = Rows * m_OutputCount;
+    m_Bytes.resize(count * sizeof(T));
+    for (size_t i = 0; i < count; ++i) {
+        const T value = static_cast<T>(m_Output[i]);
+        std::memcpy(m_Bytes.data() + i * sizeof(T), &value, sizeof(T));
+    }
+    if (!IsLittleEndian()) {
+        SwapBytes(m_Bytes.data(), count, sizeof(T));
+    }
+    Output.write(m_Bytes.data(), static_cast<std::streamsize>(m_Bytes.size()));
+}
+
+// 函数名：IsLittleEndian（静态）
+// 功能：判断本机字节序
+// 入口参数：无
+// 出口参数：无
+// 返回值：bool 小端时为true
+bool StreamInference::IsLittleEndian() {
+    const uint16_t probe{1};
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+// 函数名：SwapBytes（静态）
+// 功能：逐元素翻转字节序
+// 入口参数：char* Data, size_t Count 元素数, size_t Size 元素字节数
+// 出口参数：char* Data
+// 返回值：无
+void StreamInference::SwapBytes(char* Data, size_t Count, size_t Size) {
+    for (size_t i = 0; i < Count; ++i) {
+        std::reverse(Data + i * Size, Data + (i + 1) * Size);
+    }
+}
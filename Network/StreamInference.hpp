@@ -0,0 +1,129 @@
+//
+//  StreamInference.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】StreamInference.hpp
+//【功能模块和目的】流式批量推理类声明：从CSV或二进制输入流逐批读取样本，
+//       批量推理后写出结果，用于无交互的大规模推理
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef StreamInference_hpp
+#define StreamInference_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::istream、std::ostream所属头文件
+#include <iostream>
+//std::string所属头文件
+#include <string>
+//std::vector所属头文件
+#include <vector>
+//Network类所属头文件
+#include "Network.hpp"
+
+//------------------------------------------------------------------------------
+//【类名】StreamInference
+//【功能】流式批量推理。每次从输入流读取至多BatchSize个样本，
+//       调用Network::InferenceBatch（使用网络的编译计划与线程数）后写出，
+//       内存占用只与批大小有关，与样本总数无关。
+//       CSV格式：每行一个样本，逗号分隔，空行与'#'开头的行跳过，兼容CRLF；
+//       输出为逗号分隔的最短可往返十进制表示。
+//       二进制格式：无文件头，按行主序连续存放的小端float或double
+//【接口说明】
+//    以网络和批大小为参数构造，网络不合理时抛出std::runtime_error
+//    执行流式推理，返回处理的样本数；输入格式错误时抛出std::runtime_error
+//    静态：由名称（csv、f32、f64）得到数据格式
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+class StreamInference {
+public:
+    //--------------------------------------------------------------------------
+    //与数据交换相关的内嵌类
+    //--------------------------------------------------------------------------
+    // 数据格式
+    enum class FORMAT : int {
+        // 逗号分隔文本
+        CSV = 0,
+        // 小端float32
+        FLOAT32 = 1,
+        // 小端float64
+        FLOAT64 = 2
+    };
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 以网络和批大小为参数构造（批大小0视为1），网络需在对象使用期间有效
+    explicit StreamInference(const Network& ANetwork, size_t BatchSize = DEFAULT_BATCH_SIZE);
+    // 持有网络引用，不可拷贝
+    StreamInference(const StreamInference&) = delete;
+    // 持有网络引用，不可赋值
+    StreamInference& operator=(const StreamInference&) = delete;
+    // 虚析构函数，默认实现
+    virtual ~StreamInference() = default;
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 读完输入流为止逐批推理并写出结果，返回处理的样本数
+    size_t Run(std::istream& Input, FORMAT InputFormat,
+               std::ostream& Output, FORMAT OutputFormat);
+    //--------------------------------------------------------------------------
+    //静态成员函数
+    //--------------------------------------------------------------------------
+    // 由名称得到数据格式（csv、f32、f64，不区分大小写），未知名称抛出std::invalid_argument
+    static FORMAT ParseFormat(const std::string& Name);
+    //--------------------------------------------------------------------------
+    //静态数据成员
+    //--------------------------------------------------------------------------
+    // 默认批大小（样本数）
+    static constexpr size_t DEFAULT_BATCH_SIZE{4096};
+private:
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 读取至多一批CSV样本到输入矩阵，返回读取的样本数
+    size_t ReadCsv(std::istream& Input);
+    // 读取至多一批二进制样本到输入矩阵，返回读取的样本数
+    template <typename T>
+    size_t ReadBinary(std::istream& Input);
+    // 以CSV格式写出Rows个样本的结果
+    void WriteCsv(std::ostream& Output, size_t Rows);
+    // 以二进制格式写出Rows个样本的结果
+    template <typename T>
+    void WriteBinary(std::ostream& Output, size_t Rows);
+    // 本机是否为小端字节序
+    static bool IsLittleEndian();
+    // 逐元素翻转字节序
+    static void SwapBytes(char* Data, size_t Count, size_t Size);
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 推理使用的网络
+    const Network& m_Network;
+    // 批大小
+    size_t m_BatchSize;
+    // 输入神经元数
+    size_t m_InputCount;
+    // 输出神经元数
+    size_t m_OutputCount;
+    // 一批样本的输入矩阵（行主序）
+    std::vector<double> m_Input;
+    // 一批样本的输出矩阵（行主序）
+    std::vector<double> m_Output;
+    // 二进制读写缓冲区
+    std::vector<char> m_Bytes;
+    // CSV当前行
+    std::string m_Line;
+    // CSV输出缓冲区，每批一次写出
+    std::string m_Text;
+    // CSV已读行数，用于错误信息
+    size_t m_LineNumber{0};
+};
+//------------------------------------------------------------------------------
+
+#endif /* StreamInference_hpp */
@@ -0,0 +1,163 @@
+//
+//  ThreadPool.cpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】ThreadPool.cpp
+//【功能模块和目的】推理用工作线程池类实现
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+// ThreadPool类所属头文件
+#include "ThreadPool.hpp"
+// std::exception_ptr所属头文件
+#include <exception>
+// std::shared_ptr所属头文件
+#include <memory>
+
+//------------------------------------------------------------------------------
+//必要的构造、析构、赋值行为
+//------------------------------------------------------------------------------
+
+// 函数名：ThreadPool
+// 功能：构造函数，创建ThreadCount-1个工作线程，调用线程作为第ThreadCount个参与者
+// 入口参数：size_t ThreadCount 参与计算的线程总数
+// 出口参数：无
+// 返回值：无
+ThreadPool::ThreadPool(size_t ThreadCount) {
+    for (size_t i = 1; i < ThreadCount; ++i) {
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+// 函数名：~ThreadPool
+// 功能：析构函数，通知全部工作线程停止并等待其结束
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_TaskReady.notify_all();
+    for (auto& worker : m_Workers) {
+        worker.join();
+    }
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Getter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：GetThreadCount
+// 功能：获取参与计算的线程总数（工作线程数加调用线程）
+// 入口参数：无
+// 出口参数：无
+// 返回值：size_t 线程总数
+size_t ThreadPool::GetThreadCount() const {
+    return m_Workers.size() + 1;
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//非静态Setter成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：ParallelFor
+// 功能：并行执行count个任务。task(1)～task(count-1)放入队列由工作线程执行，
+//       task(0)在调用线程执行；调用线程随后协助执行队列中的任务，
+//       队列取空后等待本批任务全部完成，并重新抛出其中第一个异常
+// 入口参数：size_t count 任务数, const std::function<void(size_t)>& task 任务函数
+// 出口参数：无
+// 返回值：无
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& task) {
+    if (count == 0) {
+        return;
+    }
+    // 本批任务的完成计数与异常，由各任务共享
+    class Batch {
+    public:
+        std::mutex Mutex;
+        std::condition_variable Done;
+        size_t Remaining{0};
+        std::exception_ptr Error;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->Remaining = count;
+    auto run = [batch, &task](size_t index) {
+        std::exception_ptr error;
+        try {
+            task(index);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(batch->Mutex);
+        if (error && !batch->Error) {
+            batch->Error = error;
+        }
+        if (--batch->Remaining == 0) {
+            batch->Done.notify_all();
+        }
+    };
+    if (count > 1) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (size_t i = 1; i < count; ++i) {
+                m_Tasks.emplace_back([run, i]() { run(i); });
+            }
+        }
+        m_TaskReady.notify_all();
+    }
+    run(0);
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Tasks.empty()) {
+                job = std::move(m_Tasks.front());
+                m_Tasks.pop_front();
+            }
+        }
+        if (!job) {
+            break;
+        }
+        job();
+    }
+    std::unique_lock<std::mutex> lock(batch->Mutex);
+    batch->Done.wait(lock, [&batch]() { return batch->Remaining == 0; });
+    if (batch->Error) {
+        std::rethrow_exception(batch->Error);
+    }
+}
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//私有成员函数
+//------------------------------------------------------------------------------
+
+// 函数名：WorkerLoop
+// 功能：工作线程主循环，等待并执行队列中的任务，停止且队列为空时退出
+// 入口参数：无
+// 出口参数：无
+// 返回值：无
+void ThreadPool::WorkerLoop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_TaskReady.wait(lock, [this]() { return m_Stop || !m_Tasks.empty(); });
+            if (m_Tasks.empty()) {
+                return;
+            }
+            job = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+        }
+        job();
+    }
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,90 @@
+//
+//  ThreadPool.hpp
+//
+//  Created by 孙李智 on 2026/10/17.
+//
+
+//------------------------------------------------------------------------------
+//【文件名】ThreadPool.hpp
+//【功能模块和目的】推理用工作线程池类声明
+//【开发者及日期】孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+
+#ifndef ThreadPool_hpp
+#define ThreadPool_hpp
+
+//size_t所属头文件
+#include <cstddef>
+//std::vector所属头文件
+#include <vector>
+//std::deque所属头文件
+#include <deque>
+//std::function所属头文件
+#include <functional>
+//std::thread所属头文件
+#include <thread>
+//std::mutex所属头文件
+#include <mutex>
+//std::condition_variable所属头文件
+#include <condition_variable>
+
+//------------------------------------------------------------------------------
+//【类名】ThreadPool
+//【功能】固定数量工作线程的线程池。ParallelFor把count个任务分给工作线程
+//       与调用线程共同执行，全部完成后返回；多个线程可同时调用ParallelFor
+//【接口说明】
+//    以参与计算的线程总数（含调用线程）构造
+//    禁止拷贝构造、赋值
+//    析构时停止并回收全部工作线程
+//    获取线程总数
+//    并行执行count个任务，任一任务抛出的异常在调用线程重新抛出
+//【开发者及日期】 孙李智 2026/10/17
+//【更改记录】
+//------------------------------------------------------------------------------
+class ThreadPool {
+public:
+    //--------------------------------------------------------------------------
+    //必要的构造、析构、赋值行为
+    //--------------------------------------------------------------------------
+    // 构造函数，ThreadCount为参与计算的线程总数（含调用线程），0视为1
+    explicit ThreadPool(size_t ThreadCount);
+    // 禁止拷贝构造
+    ThreadPool(const ThreadPool&) = delete;
+    // 禁止赋值
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    // 虚析构函数，停止并回收工作线程
+    virtual ~ThreadPool();
+    //--------------------------------------------------------------------------
+    //非静态Getter成员函数
+    //--------------------------------------------------------------------------
+    // 获取参与计算的线程总数（含调用线程）
+    size_t GetThreadCount() const;
+    //--------------------------------------------------------------------------
+    //非静态Setter成员函数
+    //--------------------------------------------------------------------------
+    // 并行执行task(0)～task(count-1)，task(0)在调用线程执行
+    void ParallelFor(size_t count, const std::function<void(size_t)>& task);
+private:
+    //--------------------------------------------------------------------------
+    //私有成员函数
+    //--------------------------------------------------------------------------
+    // 工作线程主循环：取出任务并执行，直至线程池停止
+    void WorkerLoop();
+    //--------------------------------------------------------------------------
+    //私有数据成员
+    //--------------------------------------------------------------------------
+    // 工作线程
+    std::vector<std::thread> m_Workers;
+    // 待执行任务队列
+    std::deque<std::function<void()>> m_Tasks;
+    // 保护任务队列与停止标志
+    std::mutex m_Mutex;
+    // 有新任务或停止时通知工作线程
+    std::condition_variable m_TaskReady;
+    // 停止标志
+    bool m_Stop{false};
+};
+//------------------------------------------------------------------------------
+
+#endif /* ThreadPool_hpp */
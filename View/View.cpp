@@ -22,6 +22,10 @@
 #include<memory>
 // std::string所需头文件
 #include <string>
+// std::ifstream、std::ofstream所需头文件
+#include <fstream>
+// std::chrono所需头文件
+#include <chrono>
 using namespace std;
 
 //函数名：View
@@ -1168,4 +1172,147 @@ string View::InferenceMenu() const {
         }
     }
     return "";
-}
\ No newline at end of file
+}
+
+//函数名：HeadlessInference（静态）
+//功能：无交互流式批量推理。命令行格式：
+//      <网络文件> [--input 文件|-] [--output 文件|-] [--input-format csv|f32|f64]
+//      [--output-format csv|f32|f64] [--batch 批大小] [--threads 线程数]
+//      [--activation accurate|table|rational]
+//      输入、输出默认为标准输入、标准输出，格式默认为csv；
+//      批大小须在[1, 2^20]内，线程数须在[1, 1024]内；
+//      文件流使用1MiB缓冲区，推理结果之外的信息只写到标准错误
+//入口参数：const std::vector<std::string>& Arguments 命令行参数（不含程序名）
+//出口参数：无
+//返回值：int 进程退出码，0表示成功，1表示执行失败，2表示参数错误
+int View::HeadlessInference(const std::vector<std::string>& Arguments) {
+    const string usage = "Usage: <network file> [--input FILE|-] [--output FILE|-]"
+                         " [--input-format csv|f32|f64] [--output-format csv|f32|f64]"
+                         " [--batch N] [--threads N] [--activation accurate|table|rational]";
+    if (Arguments.empty()) {
+        cerr << usage << endl;
+        return 2;
+    }
+    string inputName = "-";
+    string outputName = "-";
+    StreamInference::FORMAT inputFormat = StreamInference::FORMAT::CSV;
+    StreamInference::FORMAT outputFormat = StreamInference::FORMAT::CSV;
+    size_t batchSize = StreamInference::DEFAULT_BATCH_SIZE;
+    size_t threadCount = 0;
+    ActivationFunction::APPROXIMATION approximation = ActivationFunction::APPROXIMATION::ACCURATE;
+    // 按有符号整数解析计数参数（stoul会把"-1"回绕为SIZE_MAX），须为完整的数字且在[1, Max]内
+    auto parseCount = [](const string& option, const string& value, long long Max) {
+        size_t end = 0;
+        const long long count = stoll(value, &end);
+        if (end != value.size() || count <= 0 || count > Max) {
+            throw invalid_argument("Invalid value for " + option + ": " + value);
+        }
+        return static_cast<size_t>(count);
+    };
+    constexpr long long MAX_BATCH_SIZE{1 << 20};
+    constexpr long long MAX_THREAD_COUNT{1024};
+    try {
+        for (size_t i = 1; i < Arguments.size(); i += 2) {
+            if (i + 1 >= Arguments.size()) {
+                throw invalid_argument("Missing value for " + Arguments[i]);
+            }
+            const string& option = Arguments[i];
+            const string& value = Arguments[i + 1];
+            if (option == "--input") {
+                inputName = value;
+            }
+            else if (option == "--output") {
+                outputName = value;
+            }
+            else if (option == "--input-format") {
+                inputFormat = StreamInference::ParseFormat(value);
+            }
+            else if (option == "--output-format") {
+                outputFormat = StreamInference::ParseFormat(value);
+            }
+            else if (option == "--batch") {
+                batchSize = parseCount(option, value, MAX_BATCH_SIZE);
+            }
+            else if (option == "--threads") {
+                threadCount = parseCount(option, value, MAX_THREAD_COUNT);
+            }
+            else if (option == "--activation") {
+                if (value == "accurate") {
+                    approximation = ActivationFunction::APPROXIMATION::ACCURATE;
+                }
+                else if (value == "table") {
+                    approximation = ActivationFunction::APPROXIMATION::TABLE;
+                }
+                else if (value == "rational") {
+                    approximation = ActivationFunction::APPROXIMATION::RATIONAL;
+                }
+                else {
+                    throw invalid_argument("Unknown activation approximation " + value);
+                }
+            }
+            else {
+                throw invalid_argument("Unknown option " + option);
+            }
+        }
+    } catch (const exception& e) {
+        cerr << e.what() << endl << usage << endl;
+        return 2;
+    }
+
+    shared_ptr<Controller> Ctrller = Controller::GetInstance();
+    Controller::RES res = Ctrller->ImportCurrentNetwork(Arguments[0]);
+    if (res == Controller::RES::OK && threadCount > 0) {
+        res = Ctrller->SetInferenceThreadCountOfCurrentNetwork(threadCount);
+    }
+    if (res == Controller::RES::OK) {
+        res = Ctrller->SetActivationApproximationOfCurrentNetwork(approximation);
+    }
+    if (res != Controller::RES::OK) {
+        cerr << "Failed to load " << Arguments[0] << ": "
+             << Controller::RES_STR[static_cast<int>(res)] << endl;
+        return 1;
+    }
+
+    // 标准流不与C stdio同步，使用自身的缓冲区
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+    // 文件流缓冲区须在打开文件前设置
+    constexpr size_t BUFFER_SIZE{1 << 20};
+    vector<char> inputBuffer(BUFFER_SIZE);
+    vector<char> outputBuffer(BUFFER_SIZE);
+    ifstream inputFile;
+    ofstream outputFile;
+    istream* pInput = &cin;
+    ostream* pOutput = &cout;
+    if (inputName != "-") {
+        inputFile.rdbuf()->pubsetbuf(inputBuffer.data(), BUFFER_SIZE);
+        inputFile.open(inputName, ios::binary);
+        if (!inputFile) {
+            cerr << "Cannot open input file " << inputName << endl;
+            return 1;
+        }
+        pInput = &inputFile;
+    }
+    if (outputName != "-") {
+        outputFile.rdbuf()->pubsetbuf(outputBuffer.data(), BUFFER_SIZE);
+        outputFile.open(outputName, ios::binary);
+        if (!outputFile) {
+            cerr << "Cannot open output file " << outputName << endl;
+            return 1;
+        }
+        pOutput = &outputFile;
+    }
+
+    size_t rows = 0;
+    auto begin = chrono::steady_clock::now();
+    res = Ctrller->InferenceStreamOnCurrentNetwork(*pInput, inputFormat,
+                                                   *pOutput, outputFormat,
+                                                   batchSize, rows);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+    if (res != Controller::RES::OK) {
+        cerr << "Inference failed: " << Controller::RES_STR[static_cast<int>(res)] << endl;
+        return 1;
+    }
+    cerr << rows << " rows in " << seconds << " s" << endl;
+    return 0;
+}
@@ -16,6 +16,8 @@
 
 //std::string所属头文件
 #include <string>
+//std::vector所属头文件
+#include <vector>
 
 //------------------------------------------------------------------------------
 //【类名】View
@@ -48,6 +50,7 @@
 //    显示统计信息
 //    验证网络
 //    执行推理
+//    静态：无交互流式批量推理（由命令行参数驱动，不显示菜单）
 
 //【开发者及日期】 孙李智 2024/7/16
 //【更改记录】
@@ -99,6 +102,8 @@ public:
     virtual std::string ValidateNetworkMenu() const;  
     // 执行推理
     virtual std::string InferenceMenu() const;   
+    // 无交互流式批量推理：参数为命令行参数（不含程序名），返回进程退出码
+    static int HeadlessInference(const std::vector<std::string>& Arguments);
 };
 
 #endif /* View_hpp */
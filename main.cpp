@@ -17,6 +17,8 @@
 #include "./Network/Importer.hpp"
 //Layer所需头文件
 #include "./Network/Layer.hpp"
+//Synapse所需头文件
+#include "./Network/Synapse.hpp"
 //Neuron所需头文件
 #include "./Network/Neuron.hpp"
 //FilePorter所需头文件
@@ -37,12 +39,130 @@
 #include <type_traits>
 //Controller所需头文件
 #include "./Controller/Controller.hpp"
+//CompiledNetwork所需头文件
+#include "./Network/CompiledNetwork.hpp"
+//InferenceSession所需头文件
+#include "./Network/InferenceSession.hpp"
+//Network_HPP_Exporter所需头文件
+#include "./Network/Network_HPP_Exporter.hpp"
+//NetworkOptimizer所需头文件
+#include "./Network/NetworkOptimizer.hpp"
+//StreamInference所需头文件
+#include "./Network/StreamInference.hpp"
+//InferenceQueue所需头文件
+#include "./Network/InferenceQueue.hpp"
+//PipelineExecutor所需头文件
+#include "./Network/PipelineExecutor.hpp"
+//DagExecutor所需头文件
+#include "./Network/DagExecutor.hpp"
+#if __cplusplus >= 202002L
+//FixedNetwork所需头文件（C++20）
+#include "./Network/FixedNetwork.hpp"
+#endif
+//std::fabs所需头文件
+#include <cmath>
+//std::thread头文件
+#include <thread>
+//std::memcpy头文件
+#include <cstring>
+//std::numeric_limits头文件
+#include <limits>
+//std::regex头文件
+#include <regex>
+//std::map头文件
+#include <map>
 
 
 using Importer_test = FilePorter<FilePorterType::IMPORTER>;
 using Exporter_test = FilePorter<FilePorterType::EXPORTER>;
 
-int main() {
+// 函数名：Connect
+// 功能：测试用：在两个神经元间添加突触，并刷新网络结构版本号
+// 入口参数：Network& ANetwork, const std::shared_ptr<Neuron>& Source 源神经元,
+//           const std::shared_ptr<Neuron>& Target 目标神经元, double Weight 权重
+// 出口参数：Network& ANetwork
+// 返回值：无
+static void Connect(Network& ANetwork, const std::shared_ptr<Neuron>& Source,
+                    const std::shared_ptr<Neuron>& Target, double Weight) {
+    auto synapse = std::make_shared<Synapse>(Source, Target, Weight);
+    Source->AddAxonOutput(synapse);
+    Target->AddDendrite(synapse);
+    ANetwork.Touch();
+}
+
+// 函数名：InferExported
+// 功能：测试用：只依据Network_HPP_Exporter生成的文本（参数数组、分组注释、输出赋值）
+//       重新计算infer，用于核对导出的偏置、权重、编号与分组是否与网络一致
+// 入口参数：const std::string& Text 头文件内容, const std::vector<double>& Input 输入值列表
+// 出口参数：无
+// 返回值：std::vector<double> 输出值列表
+static std::vector<double> InferExported(const std::string& Text, const std::vector<double>& Input) {
+    // 参数数组：名称到元素值
+    std::map<std::string, std::vector<double>> arrays;
+    const std::regex arrayPattern(R"(static constexpr \w+ (\w+)\[[^=]*= \{([^;]*)\};)");
+    for (std::sregex_iterator it(Text.begin(), Text.end(), arrayPattern), end; it != end; ++it) {
+        std::string items = (*it)[2];
+        for (char& ch : items) {
+            if (ch == '{' || ch == '}' || ch == ',' || ch == 'f') {
+                ch = ' ';
+            }
+        }
+        std::istringstream stream(items);
+        double value;
+        while (stream >> value) {
+            arrays[(*it)[1]].push_back(value);
+        }
+    }
+    std::smatch count;
+    assert(std::regex_search(Text, count, std::regex(R"(NEURON_COUNT\{(\d+)\})")));
+    std::vector<double> v(std::stoul(count[1]), 0.0);
+    for (size_t i = 0; i < Input.size(); ++i) {
+        v[i] = Input[i] + arrays["B0"][i];
+    }
+    // 各组：神经元区间、激活类型，以及稠密（W[c][r]）或稀疏（W、S、R）权重
+    const std::regex groupPattern(R"(// 第(\d+)组：神经元\[(\d+), (\d+)\)，激活类型(\d+))"
+                                  R"((，(稠密|稀疏)，源神经元\[(\d+), (\d+)\))?)");
+    for (std::sregex_iterator it(Text.begin(), Text.end(), groupPattern), end; it != end; ++it) {
+        const std::smatch& group = *it;
+        const std::string id = group[1];
+        const size_t begin = std::stoul(group[2]);
+        const size_t rows = std::stoul(group[3]) - begin;
+        const std::vector<double>& bias = arrays["B" + id];
+        const std::vector<double>& weight = arrays["W" + id];
+        assert(bias.size() == rows);
+        for (size_t r = 0; r < rows; ++r) {
+            double sum = bias[r];
+            if (group[6] == "稠密") {
+                const size_t lo = std::stoul(group[7]);
+                const size_t cols = std::stoul(group[8]) - lo;
+                assert(weight.size() == rows * cols);
+                for (size_t c = 0; c < cols; ++c) {
+                    sum += weight[c * rows + r] * v[lo + c];
+                }
+            } else if (group[6] == "稀疏") {
+                const std::vector<double>& source = arrays["S" + id];
+                const std::vector<double>& rowStart = arrays["R" + id];
+                for (size_t k = static_cast<size_t>(rowStart[r]); k < rowStart[r + 1]; ++k) {
+                    sum += weight[k] * v[static_cast<size_t>(source[k])];
+                }
+            }
+            v[begin + r] = ActivationFunction::Evaluate(std::stoi(group[4]), sum);
+        }
+    }
+    std::vector<double> output;
+    const std::regex outputPattern(R"(output\[(\d+)\] = v\[(\d+)\];)");
+    for (std::sregex_iterator it(Text.begin(), Text.end(), outputPattern), end; it != end; ++it) {
+        assert(std::stoul((*it)[1]) == output.size());
+        output.push_back(v[std::stoul((*it)[2])]);
+    }
+    return output;
+}
+
+int main(int argc, char* argv[]) {
+    //带命令行参数时执行无交互流式批量推理
+    if (argc > 1) {
+        return View::HeadlessInference(std::vector<std::string>(argv + 1, argv + argc));
+    }
     {
         //创建层
         auto layer = std::make_shared<Layer>(1);
@@ -60,11 +180,30 @@ int main() {
         const auto& neurons = layer->GetNeurons();
 
     }
+    //激活函数：同类型共享单例，按类型码内联计算与虚函数计算一致
+    {
+        assert(ActivationFunction::createAF(1) == ActivationFunction::createAF(1));
+        assert(ActivationFunction::createAF(ActivationFunction::TYPE_COUNT) == nullptr);
+        for (int type = 0; type < ActivationFunction::TYPE_COUNT; ++type) {
+            const ActivationFunction* function = ActivationFunction::GetInstance(type);
+            //常量折叠与库函数可能相差1ulp
+            assert(std::fabs(ActivationFunction::Evaluate(type, -0.7) - (*function)(-0.7)) < 1e-15);
+        }
+    }
     //静态容器
     {
         StaticContainer<int,5> sc;
         assert(sc.COUNT == 5);
     }
+    //无交互批量推理：批大小、线程数须为正整数且不超过上限，否则在载入网络前返回参数错误
+    {
+        for (const char* value : {"-1", "0", "abc", "4x", "99999999999999999999"}) {
+            assert(View::HeadlessInference({"network.ANN", "--batch", value}) == 2);
+            assert(View::HeadlessInference({"network.ANN", "--threads", value}) == 2);
+        }
+        assert(View::HeadlessInference({"network.ANN", "--batch", "2000000"}) == 2);
+        assert(View::HeadlessInference({"network.ANN", "--threads", "2000"}) == 2);
+    }
     
     {
         // 1.注册导入器
@@ -75,7 +214,828 @@ int main() {
         Network network = importer->LoadFromFile("simple.ANN");
         std::cout<<"name:"<<network.Name<<std::endl;
     }
+
+    {
+        //编译推理计划，结果与对象图推理一致
+        auto importer = Network_Importer::GetIstanceByExtName("ANN");
+        Network network = importer->LoadFromFile("simple.ANN");
+        CompiledNetwork plan = network.Compile();
+        assert(plan.GetNeuronCount() == 6);
+        assert(plan.GetSynapseCount() == 9);
+        assert(plan.GetDenseStageCount() == 1);
+        std::vector<double> input{1.0, 2.0, 3.0};
+        auto expected = network.Inference(input);
+        auto actual = plan.Inference(input);
+        assert(actual.size() == expected.size());
+        for (size_t i = 0; i < actual.size(); ++i) {
+            assert(std::fabs(actual[i] - expected[i]) < 1e-12);
+        }
+        //批量推理，第二个样本与单样本推理一致
+        std::vector<double> batchIn{0.0, 0.0, 0.0, 1.0, 2.0, 3.0};
+        std::vector<double> batchOut(6);
+        network.InferenceBatch(batchIn.data(), 2, batchOut.data());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(std::fabs(batchOut[3 + i] - expected[i]) < 1e-12);
+        }
+        //int8量化计划，以批量样本校准，偏差在量化误差范围内
+        CompiledNetwork quantized(network, batchIn);
+        assert(quantized.GetPrecision() == CompiledNetwork::PRECISION::INT8);
+        auto report = quantized.CompareWith(network, batchIn);
+        assert(report.Samples == 2);
+        assert(report.MaxAbs < 0.05);
+        //多线程批量推理与单线程结果一致
+        std::vector<double> manyIn(300 * 3);
+        for (size_t i = 0; i < manyIn.size(); ++i) {
+            manyIn[i] = static_cast<double>(i % 7) - 3.0;
+        }
+        std::vector<double> serialOut(300 * 3);
+        std::vector<double> parallelOut(300 * 3);
+        plan.InferenceBatch(manyIn.data(), 300, serialOut.data());
+        plan.SetThreadCount(3);
+        assert(plan.GetThreadCount() == 3);
+        plan.InferenceBatch(manyIn.data(), 300, parallelOut.data());
+        assert(serialOut == parallelOut);
+        //增量推理会话：只改变一个输入，结果与完整推理一致
+        InferenceSession session(network);
+        session.Inference({0.0, 0.0, 0.0});
+        auto incremental = session.Inference({1.0, 0.0, 0.0});
+        incremental = session.Inference(input);
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(std::fabs(incremental[i] - expected[i]) < 1e-12);
+        }
+        //使用调用者持有的上下文推理，两个线程共享同一只读网络
+        const Network& shared = network;
+        std::vector<double> first;
+        std::vector<double> second;
+        std::thread worker([&]() {
+            CompiledNetwork::InferenceContext context;
+            first = shared.Inference(input, context);
+        });
+        CompiledNetwork::InferenceContext context;
+        second = shared.Inference(input, context);
+        worker.join();
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(std::fabs(first[i] - expected[i]) < 1e-12);
+            assert(std::fabs(second[i] - expected[i]) < 1e-12);
+        }
+        //推理结果缓存：重复输入命中，修改偏置后自动失效
+        network.SetCacheCapacity(2);
+        network.Inference(input);
+        auto cached = network.Inference(input);
+        assert(cached == network.Inference(input));
+        assert(network.GetCacheStatistics().Hits == 2);
+        assert(network.GetCacheStatistics().Misses == 1);
+        network.GetLayers().back()->GetNeurons().front()->SetBias(1.0);
+        auto changed = network.Inference(input);
+        assert(changed != cached);
+        assert(network.GetCacheStatistics().Invalidations == 1);
+        network.Inference({0.0, 0.0, 0.0});
+        network.Inference({1.0, 0.0, 0.0});
+        assert(network.GetCacheStatistics().Size == 2);
+        assert(network.GetCacheStatistics().Evictions == 1);
+        //导出为C++头文件：以网络名称为命名空间，包含权重数组与infer函数
+        assert(Network_HPP_Exporter::Identifier(" Rotation Network\r") == "Rotation_Network");
+        assert(Network_HPP_Exporter::Identifier("2D") == "ANN_2D");
+        std::string headerName =
+            (std::filesystem::temp_directory_path() / "simple_network.hpp").string();
+        Network_HPP_Exporter().SaveToFile(headerName, network);
+        std::ifstream header(headerName);
+        std::stringstream text;
+        text << header.rdbuf();
+        assert(text.str().find("inline void infer(const float* input, float* output)")
+               != std::string::npos);
+        assert(text.str().find("static constexpr float W1[3][3]") != std::string::npos);
+        //小网络的工作数组仍放在栈上
+        assert(text.str().find("static thread_local") == std::string::npos);
+        //按导出的数组重新计算，与网络推理一致（参数以float保存）
+        for (const auto& sample : std::vector<std::vector<double>>{input, {0.5, -1.0, 0.25}}) {
+            auto exported = InferExported(text.str(), sample);
+            auto reference = network.Inference(sample);
+            assert(exported.size() == reference.size());
+            for (size_t i = 0; i < reference.size(); ++i) {
+                assert(std::fabs(exported[i] - reference[i]) < 1e-5 * (1.0 + std::fabs(reference[i])));
+            }
+        }
+        header.close();
+        //偏置转为float后溢出为无穷大时无法写成浮点字面量，拒绝导出
+        network.GetLayers().back()->GetNeurons().front()->SetBias(1e39);
+        bool rejected = false;
+        try {
+            Network_HPP_Exporter().SaveToFile(headerName, network);
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        assert(rejected);
+        std::filesystem::remove(headerName);
+    }
+
+    {
+        //跳跃连接且层乱序添加：对象图推理按波前顺序执行，与编译计划一致
+        Network network;
+        auto inputLayer = std::make_shared<Layer>(0);
+        auto hiddenLayer = std::make_shared<Layer>(1);
+        auto outputLayer = std::make_shared<Layer>(2);
+        network.AddLayer(inputLayer);
+        network.AddLayer(outputLayer);
+        network.AddLayer(hiddenLayer);
+        auto in = std::make_shared<Neuron>(0.0, 0);
+        auto hidden = std::make_shared<Neuron>(0.1, 1);
+        auto out = std::make_shared<Neuron>(0.2, 2);
+        inputLayer->AddNeuron(in);
+        hiddenLayer->AddNeuron(hidden);
+        outputLayer->AddNeuron(out);
+        Connect(network, in, hidden, 0.5);
+        Connect(network, hidden, out, -1.0);
+        Connect(network, in, out, 0.3);
+        network.SetInputMarker(in);
+        network.SetOutputMarker(out);
+        assert(network.GetWavefronts().size() == 3);
+        auto actual = network.Inference({0.7});
+        auto expected = network.Compile().Inference({0.7});
+        assert(std::fabs(actual[0] - expected[0]) < 1e-12);
+    }
+
+    {
+        //增量推理会话：输入大幅变化或出现无穷大后，结果仍与完整推理一致
+        Network network;
+        auto inputLayer = std::make_shared<Layer>(0);
+        auto hiddenLayer = std::make_shared<Layer>(1);
+        auto outputLayer = std::make_shared<Layer>(2);
+        network.AddLayer(inputLayer);
+        network.AddLayer(hiddenLayer);
+        network.AddLayer(outputLayer);
+        auto x = std::make_shared<Neuron>(0.0, 0);
+        auto y = std::make_shared<Neuron>(0.0, 0);
+        auto linear = std::make_shared<Neuron>(0.1, 0);
+        auto squashed = std::make_shared<Neuron>(-0.2, 2);
+        auto out = std::make_shared<Neuron>(0.05, 2);
+        inputLayer->AddNeuron(x);
+        inputLayer->AddNeuron(y);
+        hiddenLayer->AddNeuron(linear);
+        hiddenLayer->AddNeuron(squashed);
+        outputLayer->AddNeuron(out);
+        Connect(network, x, linear, 1.0);
+        Connect(network, y, linear, 0.7);
+        Connect(network, x, squashed, 1.0);
+        Connect(network, y, squashed, 1.3);
+        Connect(network, linear, out, 0.4);
+        Connect(network, squashed, out, 0.9);
+        network.SetInputMarker(x);
+        network.SetInputMarker(y);
+        network.SetOutputMarker(out);
+        InferenceSession session(network);
+        const double inf = std::numeric_limits<double>::infinity();
+        const std::vector<std::vector<double>> inputs = {
+            {0.0, 0.0}, {1e17, 0.0}, {0.0, 0.3}, {inf, 0.0}, {0.0, 0.3}, {-0.5, 0.3}};
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            auto actual = session.Inference(inputs[i]);
+            auto expected = network.Inference(inputs[i]);
+            assert(actual.size() == 1);
+            assert(std::fabs(actual[0] - expected[0]) < 1e-12);
+        }
+    }
+
+    {
+        //增量推理会话：两条互不相连的支路，改变一个输入只重新计算该支路的前向锥
+        Network network;
+        std::vector<std::shared_ptr<Layer>> layers;
+        for (size_t l = 0; l < 4; ++l) {
+            layers.push_back(std::make_shared<Layer>(l));
+            network.AddLayer(layers.back());
+        }
+        auto a = std::make_shared<Neuron>(0.0, 0);
+        auto b = std::make_shared<Neuron>(0.0, 0);
+        auto a1 = std::make_shared<Neuron>(0.1, 2);
+        auto b1 = std::make_shared<Neuron>(-0.1, 2);
+        auto a2 = std::make_shared<Neuron>(0.2, 1);
+        auto outA = std::make_shared<Neuron>(0.0, 0);
+        auto outB = std::make_shared<Neuron>(0.3, 2);
+        layers[0]->AddNeuron(a);
+        layers[0]->AddNeuron(b);
+        layers[1]->AddNeuron(a1);
+        layers[1]->AddNeuron(b1);
+        layers[2]->AddNeuron(a2);
+        layers[3]->AddNeuron(outA);
+        layers[3]->AddNeuron(outB);
+        Connect(network, a, a1, 0.8);
+        Connect(network, a1, a2, -1.2);
+        Connect(network, a2, outA, 0.5);
+        Connect(network, b, b1, 1.1);
+        Connect(network, b1, outB, 0.7);
+        network.SetInputMarker(a);
+        network.SetInputMarker(b);
+        network.SetOutputMarker(outA);
+        network.SetOutputMarker(outB);
+        InferenceSession session(network);
+        session.Inference({0.2, 0.4});
+        assert(session.GetLastUpdateCount() == 5);
+        const std::vector<std::vector<double>> inputs = {{0.9, 0.4}, {0.9, -0.6}, {0.9, -0.6}};
+        const size_t expectedCount[] = {3, 2, 0};
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            auto actual = session.Inference(inputs[i]);
+            auto expected = network.Inference(inputs[i]);
+            assert(session.GetLastUpdateCount() == expectedCount[i]);
+            assert(actual.size() == 2);
+            assert(std::fabs(actual[0] - expected[0]) < 1e-12);
+            assert(std::fabs(actual[1] - expected[1]) < 1e-12);
+        }
+    }
+
+    {
+        //增量推理会话：256-32-4全连接网络，处理的突触数与变化的输入数成正比，
+        //反复小幅改变输入（超过重新求和间隔）后结果仍与完整推理一致
+        const size_t sizes[] = {256, 32, 4};
+        Network network;
+        std::vector<std::vector<std::shared_ptr<Neuron>>> neurons(3);
+        for (size_t l = 0; l < 3; ++l) {
+            auto layer = std::make_shared<Layer>(l);
+            network.AddLayer(layer);
+            for (size_t i = 0; i < sizes[l]; ++i) {
+                auto neuron = std::make_shared<Neuron>(l == 0 ? 0.0 : 0.01 * static_cast<double>(i), l == 0 ? 0 : 2);
+                layer->AddNeuron(neuron);
+                neurons[l].push_back(neuron);
+            }
+        }
+        for (size_t l = 1; l < 3; ++l) {
+            for (size_t j = 0; j < sizes[l]; ++j) {
+                for (size_t i = 0; i < sizes[l - 1]; ++i) {
+                    Connect(network, neurons[l - 1][i], neurons[l][j],
+                            0.1 * std::sin(static_cast<double>(7 * i + 3 * j + l)));
+                }
+            }
+        }
+        for (const auto& neuron : neurons[0]) {
+            network.SetInputMarker(neuron);
+        }
+        for (const auto& neuron : neurons[2]) {
+            network.SetOutputMarker(neuron);
+        }
+        InferenceSession session(network);
+        std::vector<double> input(sizes[0]);
+        for (size_t i = 0; i < input.size(); ++i) {
+            input[i] = std::cos(static_cast<double>(i));
+        }
+        session.Inference(input);
+        const size_t fullSynapses = sizes[0] * sizes[1] + sizes[1] * sizes[2];
+        assert(session.GetLastSynapseCount() == fullSynapses);
+        // 改变k个输入：k×32条输入轴突，加上32个隐藏神经元的32×4条轴突
+        for (size_t k = 1; k <= 4; ++k) {
+            for (size_t i = 0; i < k; ++i) {
+                input[i * 50] += 0.25;
+            }
+            session.Inference(input);
+            assert(session.GetLastUpdateCount() == sizes[1] + sizes[2]);
+            assert(session.GetLastSynapseCount() == k * sizes[1] + sizes[1] * sizes[2]);
+        }
+        for (size_t step = 0; step < 3000; ++step) {
+            input[(step * 37) % input.size()] += 1e-3 * std::sin(static_cast<double>(step));
+            auto actual = session.Inference(input);
+            if (step % 100 == 0) {
+                auto expected = network.Inference(input);
+                for (size_t o = 0; o < expected.size(); ++o) {
+                    assert(std::fabs(actual[o] - expected[o]) < 1e-12);
+                }
+            }
+        }
+    }
+
+    {
+        //线性折叠：3-4-4-2全线性网络（含一个恒等神经元）折叠为3-2，结果不变
+        Network network;
+        std::vector<std::vector<std::shared_ptr<Neuron>>> neurons;
+        const size_t sizes[] = {3, 4, 4, 2};
+        for (size_t l = 0; l < 4; ++l) {
+            auto layer = std::make_shared<Layer>(l);
+            network.AddLayer(layer);
+            neurons.emplace_back();
+            for (size_t i = 0; i < sizes[l]; ++i) {
+                auto neuron = std::make_shared<Neuron>(0.1 * static_cast<double>(l + i), 0);
+                layer->AddNeuron(neuron);
+                neurons[l].push_back(neuron);
+            }
+        }
+        for (size_t l = 0; l + 1 < 4; ++l) {
+            for (size_t i = 0; i < sizes[l]; ++i) {
+                for (size_t j = 0; j < sizes[l + 1]; ++j) {
+                    Connect(network, neurons[l][i], neurons[l + 1][j],
+                            0.25 * static_cast<double>((i * 3 + j * 5 + l) % 7) - 0.75);
+                }
+            }
+        }
+        //恒等神经元：输出层前插入的权重1、偏置0的线性神经元
+        auto identity = std::make_shared<Neuron>(0.0, 0);
+        network.GetLayers()[2]->AddNeuron(identity);
+        Connect(network, neurons[1][0], identity, 1.0);
+        Connect(network, identity, neurons[3][1], 0.5);
+        for (const auto& neuron : neurons[0]) {
+            network.SetInputMarker(neuron);
+        }
+        for (const auto& neuron : neurons[3]) {
+            network.SetOutputMarker(neuron);
+        }
+        Network optimized;
+        optimized = network;
+        auto report = NetworkOptimizer::FoldLinear(optimized);
+        assert(report.NeuronsRemoved == 9);
+        assert(report.LayersRemoved == 2);
+        assert(optimized.GetLayers().size() == 2);
+        assert(report.FlopsAfter < report.FlopsBefore);
+        assert(optimized.IsValid());
+        const std::vector<double> input = {0.3, -1.2, 2.0};
+        auto expected = network.Inference(input);
+        auto actual = optimized.Inference(input);
+        for (size_t i = 0; i < actual.size(); ++i) {
+            assert(std::fabs(actual[i] - expected[i]) < 1e-12);
+        }
+    }
+
+    {
+        //流式批量推理：CSV输入（含注释行、空行、CRLF），CSV与二进制输出与逐样本推理一致
+        auto importer = Network_Importer::GetIstanceByExtName("ANN");
+        Network network = importer->LoadFromFile("simple.ANN");
+        std::istringstream csv("# x,y,z\n1,2,3\r\n\n -0.5 , 0.25,+4\n0,0,1e-3\n");
+        std::ostringstream text;
+        StreamInference stream(network, 2);
+        assert(stream.Run(csv, StreamInference::FORMAT::CSV,
+                          text, StreamInference::FORMAT::CSV) == 3);
+        std::istringstream lines(text.str());
+        const std::vector<std::vector<double>> inputs = {{1, 2, 3}, {-0.5, 0.25, 4}, {0, 0, 1e-3}};
+        std::vector<double> flat;
+        for (const auto& input : inputs) {
+            auto expected = network.Inference(input);
+            std::string line;
+            std::getline(lines, line);
+            std::istringstream fields(line);
+            for (double value : expected) {
+                std::string field;
+                std::getline(fields, field, ',');
+                assert(std::stod(field) == value);
+            }
+            flat.insert(flat.end(), input.begin(), input.end());
+        }
+        std::istringstream binary(std::string(reinterpret_cast<const char*>(flat.data()),
+                                              flat.size() * sizeof(double)));
+        std::ostringstream packed;
+        assert(stream.Run(binary, StreamInference::FORMAT::FLOAT64,
+                          packed, StreamInference::FORMAT::FLOAT64) == 3);
+        std::vector<double> outputs(9);
+        assert(packed.str().size() == outputs.size() * sizeof(double));
+        std::memcpy(outputs.data(), packed.str().data(), packed.str().size());
+        assert(outputs[3] == network.Inference(inputs[1])[0]);
+        //列数不符时抛出异常
+        std::istringstream bad("1,2\n");
+        bool thrown = false;
+        try {
+            stream.Run(bad, StreamInference::FORMAT::CSV, text, StreamInference::FORMAT::CSV);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert(StreamInference::ParseFormat("F32") == StreamInference::FORMAT::FLOAT32);
+    }
+
+    {
+        //异步推理队列：单线程连续提交8个请求，最大批大小4、等待上限1秒时凑成两个满批，
+        //析构时不再等待，剩余的1个请求单独成批；多线程并发提交的结果与逐样本推理一致
+        auto importer = Network_Importer::GetIstanceByExtName("ANN");
+        Network network = importer->LoadFromFile("simple.ANN");
+        std::vector<std::future<std::vector<double>>> results;
+        InferenceQueue::Statistics statistics;
+        {
+            InferenceQueue queue(network, 4, std::chrono::seconds(1));
+            for (size_t i = 0; i < 8; ++i) {
+                results.push_back(queue.Submit({0.1 * static_cast<double>(i), 1.0, -1.0}));
+            }
+            for (auto& result : results) {
+                result.wait();
+            }
+            results.push_back(queue.Submit({0.0, 0.0, 1.0}));
+            statistics = queue.GetStatistics();
+        }
+        assert(statistics.Batches == 2);
+        assert(statistics.BatchSizeHistogram[4] == 2);
+        assert(statistics.P99Latency >= statistics.P50Latency);
+        assert(results.back().get() == network.Inference({0.0, 0.0, 1.0}));
+        InferenceQueue queue(network);
+        std::vector<std::thread> clients;
+        std::vector<bool> matched(4, true);
+        for (size_t t = 0; t < 4; ++t) {
+            clients.emplace_back([&queue, &network, &matched, t]() {
+                for (size_t i = 0; i < 100; ++i) {
+                    std::vector<double> input = {static_cast<double>(t), static_cast<double>(i), 0.5};
+                    CompiledNetwork::InferenceContext context;
+                    if (queue.Submit(input).get() != network.Inference(input, context)) {
+                        matched[t] = false;
+                    }
+                }
+            });
+        }
+        for (auto& client : clients) {
+            client.join();
+        }
+        assert(std::find(matched.begin(), matched.end(), false) == matched.end());
+        assert(queue.GetStatistics().Requests == 400);
+    }
+
+    {
+        //流水线执行器：200个样本分为4块依次流过各级，结果与批量推理一致；
+        //级数超过计划阶段数时取阶段数，每级都处理了全部块
+        auto importer = Network_Importer::GetIstanceByExtName("ANN");
+        Network network = importer->LoadFromFile("simple.ANN");
+        const size_t batch = 200;
+        const size_t inputCount = network.GetInputMarker().size();
+        const size_t outputCount = network.GetOutputMarker().size();
+        std::vector<double> input(batch * inputCount);
+        for (size_t i = 0; i < input.size(); ++i) {
+            input[i] = std::sin(0.37 * static_cast<double>(i));
+        }
+        std::vector<double> expected(batch * outputCount);
+        std::vector<double> actual(batch * outputCount);
+        network.InferenceBatch(input.data(), batch, expected.data());
+        for (size_t stages : {1, 2, 100}) {
+            PipelineExecutor pipeline(network, stages);
+            assert(pipeline.GetStageCount() >= 1 && pipeline.GetStageCount() <= stages);
+            for (size_t round = 0; round < 3; ++round) {
+                //空闲足够久后工作线程在条件变量上阻塞，新的批次须能将其唤醒
+                std::this_thread::sleep_for(std::chrono::milliseconds(5 * round));
+                std::fill(actual.begin(), actual.end(), 0.0);
+                pipeline.InferenceBatch(input.data(), batch, actual.data());
+                for (size_t i = 0; i < actual.size(); ++i) {
+                    assert(std::fabs(actual[i] - expected[i]) < 1e-12);
+                }
+            }
+            const auto statistics = pipeline.GetStatistics();
+            assert(statistics.front().FirstStage == 0);
+            for (size_t s = 0; s < statistics.size(); ++s) {
+                assert(statistics[s].Tiles == 12);
+                if (s > 0) {
+                    assert(statistics[s].FirstStage == statistics[s - 1].LastStage);
+                }
+            }
+            pipeline.ResetStatistics();
+            assert(pipeline.GetStatistics().front().Tiles == 0);
+        }
+    }
+
+    {
+        //任务图执行器：两个互不相连的两层分支汇入同一输出层，
+        //每个分支每层为一个任务，共5个任务、关键路径3个任务；结果与逐样本推理一致
+        Network network;
+        std::vector<std::shared_ptr<Layer>> layers;
+        for (size_t l = 0; l < 6; ++l) {
+            layers.push_back(std::make_shared<Layer>(l));
+            network.AddLayer(layers.back());
+        }
+        std::vector<std::vector<std::shared_ptr<Neuron>>> neurons(6);
+        const size_t sizes[6] = {2, 3, 3, 3, 3, 2};
+        for (size_t l = 0; l < 6; ++l) {
+            for (size_t i = 0; i < sizes[l]; ++i) {
+                neurons[l].push_back(std::make_shared<Neuron>(0.1 * static_cast<double>(i + l),
+                    l == 0 ? ActivationFunction::LINEAR : ActivationFunction::TANH));
+                layers[l]->AddNeuron(neurons[l].back());
+            }
+        }
+        //层1、3为分支A，层2、4为分支B，层5为输出
+        const size_t links[5][2] = {{0, 1}, {0, 2}, {1, 3}, {2, 4}, {3, 5}};
+        for (const auto& link : links) {
+            for (size_t i = 0; i < sizes[link[0]]; ++i) {
+                for (size_t j = 0; j < sizes[link[1]]; ++j) {
+                    Connect(network, neurons[link[0]][i], neurons[link[1]][j],
+                            0.3 * static_cast<double>((i * 5 + j * 3 + link[1]) % 7) - 0.9);
+                }
+            }
+        }
+        for (size_t i = 0; i < 3; ++i) {
+            Connect(network, neurons[4][i], neurons[5][i % 2], 0.7);
+        }
+        for (const auto& neuron : neurons[0]) {
+            network.SetInputMarker(neuron);
+        }
+        for (const auto& neuron : neurons[5]) {
+            network.SetOutputMarker(neuron);
+        }
+        for (size_t threads : {1, 3}) {
+            DagExecutor executor(network, threads);
+            assert(executor.GetThreadCount() == threads);
+            assert(executor.GetTaskCount() == 5);
+            assert(executor.GetCriticalPathLength() == 3);
+            for (size_t i = 0; i < 50; ++i) {
+                const std::vector<double> input = {std::sin(static_cast<double>(i)),
+                                                   std::cos(static_cast<double>(i))};
+                const auto expected = network.Inference(input);
+                const auto actual = executor.Inference(input);
+                assert(actual.size() == expected.size());
+                for (size_t k = 0; k < actual.size(); ++k) {
+                    assert(std::fabs(actual[k] - expected[k]) < 1e-12);
+                }
+            }
+        }
+        auto importer = Network_Importer::GetIstanceByExtName("ANN");
+        Network loaded = importer->LoadFromFile("simple.ANN");
+        DagExecutor executor(loaded, 2);
+        assert(executor.Inference({0.5, -0.25, 1.0}).size() == loaded.GetOutputMarker().size());
+    }
+
+    {
+        //Sigmoid、Tanh快速近似：在[-40, 40]的细网格及全体double数量级（非规格化数至最大值、
+        //无穷）上误差不超过文档给出的上界，NaN保持为NaN；其他类型不受近似方式影响。
+        //网络设置近似方式后，编译计划与由网络构造的执行器随之改变
+        using APPROXIMATION = ActivationFunction::APPROXIMATION;
+        std::vector<double> samples;
+        for (int i = -400000; i <= 400000; ++i) {
+            samples.push_back(1e-4 * static_cast<double>(i));
+        }
+        for (int e = -1074; e <= 1023; ++e) {
+            for (double mantissa : {1.0, 1.3, 1.7}) {
+                samples.push_back(std::ldexp(mantissa, e));
+                samples.push_back(-std::ldexp(mantissa, e));
+            }
+        }
+        const double infinity = std::numeric_limits<double>::infinity();
+        samples.insert(samples.end(), {std::numeric_limits<double>::max(),
+                                       -std::numeric_limits<double>::max(),
+                                       infinity, -infinity, -0.0});
+        std::vector<double> values(samples.size());
+        for (APPROXIMATION mode : {APPROXIMATION::TABLE, APPROXIMATION::RATIONAL}) {
+            const double bound = mode == APPROXIMATION::TABLE ? ActivationFunction::TABLE_ERROR
+                                                              : ActivationFunction::RATIONAL_ERROR;
+            for (int type : {ActivationFunction::SIGMOID, ActivationFunction::TANH}) {
+                const ActivationFunction* pFunction = ActivationFunction::GetInstance(type, mode);
+                const double limit = type == ActivationFunction::SIGMOID ? bound / 2 : bound;
+                pFunction->Apply(samples.data(), values.data(), samples.size());
+                for (size_t i = 0; i < samples.size(); ++i) {
+                    const double exact = ActivationFunction::Evaluate(type, samples[i]);
+                    assert(std::fabs(values[i] - exact) <= limit);
+                    assert(std::fabs((*pFunction)(samples[i]) - exact) <= limit);
+                }
+                const double nan = std::numeric_limits<double>::quiet_NaN();
+                assert(std::isnan((*pFunction)(nan)));
+                std::vector<double> nans(8, nan);
+                pFunction->Apply(nans.data(), nans.data(), nans.size());
+                assert(std::isnan(nans.front()) && std::isnan(nans.back()));
+            }
+            assert(ActivationFunction::GetInstance(ActivationFunction::RELU, mode)
+                   == ActivationFunction::GetInstance(ActivationFunction::RELU));
+        }
+        auto importer = Network_Importer::GetIstanceByExtName("ANN");
+        Network network = importer->LoadFromFile("simple.ANN");
+        const std::vector<double> input = {0.3, -1.2, 2.5, 0.7, 0.1, -0.4};
+        std::vector<double> accurate(2 * network.GetOutputMarker().size());
+        std::vector<double> table(accurate.size());
+        network.InferenceBatch(input.data(), 2, accurate.data());
+        network.SetActivationApproximation(APPROXIMATION::TABLE);
+        assert(network.Compile().GetApproximation() == APPROXIMATION::TABLE);
+        network.InferenceBatch(input.data(), 2, table.data());
+        for (size_t i = 0; i < table.size(); ++i) {
+            assert(std::fabs(table[i] - accurate[i]) < 1e-4);
+        }
+        Network copy;
+        copy = network;
+        assert(copy.GetActivationApproximation() == APPROXIMATION::TABLE);
+        DagExecutor executor(copy, 1);
+        const auto output = executor.Inference({0.3, -1.2, 2.5});
+        for (size_t i = 0; i < output.size(); ++i) {
+            assert(std::fabs(output[i] - table[i]) < 1e-12);
+        }
+    }
+
+    {
+        //部分输出推理：2个输入经两个互不相连的3神经元分支分别到达2个输出，
+        //只求一个输出时计划只含其反向锥（2个输入、3个隐藏、1个输出共6个神经元）
+        Network network;
+        std::vector<std::shared_ptr<Layer>> layers;
+        std::vector<std::vector<std::shared_ptr<Neuron>>> neurons(4);
+        const size_t sizes[4] = {2, 3, 3, 2};
+        for (size_t l = 0; l < 4; ++l) {
+            layers.push_back(std::make_shared<Layer>(l));
+            network.AddLayer(layers.back());
+            for (size_t i = 0; i < sizes[l]; ++i) {
+                neurons[l].push_back(std::make_shared<Neuron>(0.2 * static_cast<double>(i) - 0.1,
+                    l == 0 ? ActivationFunction::LINEAR : ActivationFunction::SIGMOID));
+                layers[l]->AddNeuron(neurons[l].back());
+            }
+        }
+        for (size_t branch = 1; branch <= 2; ++branch) {
+            for (size_t j = 0; j < 3; ++j) {
+                for (size_t i = 0; i < 2; ++i) {
+                    Connect(network, neurons[0][i], neurons[branch][j],
+                            0.5 - 0.25 * static_cast<double>(i + j));
+                }
+                Connect(network, neurons[branch][j], neurons[3][branch - 1],
+                        0.3 * static_cast<double>(j + 1));
+            }
+        }
+        for (const auto& neuron : neurons[0]) {
+            network.SetInputMarker(neuron);
+        }
+        for (const auto& neuron : neurons[3]) {
+            network.SetOutputMarker(neuron);
+        }
+        using APPROXIMATION = ActivationFunction::APPROXIMATION;
+        const CompiledNetwork cone(network, std::vector<size_t>{0}, APPROXIMATION::ACCURATE);
+        assert(cone.GetNeuronCount() == 6);
+        assert(network.Compile().GetNeuronCount() == 10);
+        assert(cone.GetInputCount() == 2 && cone.GetOutputCount() == 1);
+        for (size_t round = 0; round < 2; ++round) {
+            for (size_t i = 0; i < 20; ++i) {
+                const std::vector<double> input = {std::sin(static_cast<double>(i)),
+                                                   std::cos(static_cast<double>(i))};
+                const auto expected = network.Inference(input);
+                const auto reversed = network.InferenceSubset(input, {1, 0});
+                assert(reversed.size() == 2);
+                assert(std::fabs(reversed[0] - expected[1]) < 1e-12);
+                assert(std::fabs(reversed[1] - expected[0]) < 1e-12);
+                const auto single = network.InferenceSubset(input, {1});
+                assert(single.size() == 1 && std::fabs(single[0] - expected[1]) < 1e-12);
+            }
+            //修改偏置后缓存的计划随结构版本号失效
+            neurons[2][0]->SetBias(1.5);
+        }
+        bool thrown = false;
+        try {
+            network.InferenceSubset({0.0, 0.0}, {2});
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    {
+        //ReLU零值跳过：4-16-16-2网络隐藏层偏置为负，多数隐藏输出为零；
+        //两个以ReLU为源的阶段按本次源值稀疏度切换为散射形式，结果与逐神经元推理一致
+        Network network;
+        std::vector<std::vector<std::shared_ptr<Neuron>>> neurons(4);
+        const size_t sizes[4] = {4, 16, 16, 2};
+        for (size_t l = 0; l < 4; ++l) {
+            auto layer = std::make_shared<Layer>(l);
+            network.AddLayer(layer);
+            for (size_t i = 0; i < sizes[l]; ++i) {
+                const bool hidden = l == 1 || l == 2;
+                neurons[l].push_back(std::make_shared<Neuron>(hidden ? -0.6 : 0.0,
+                    hidden ? ActivationFunction::RELU : ActivationFunction::LINEAR));
+                layer->AddNeuron(neurons[l].back());
+            }
+        }
+        for (size_t l = 1; l < 4; ++l) {
+            for (size_t j = 0; j < sizes[l]; ++j) {
+                for (size_t i = 0; i < sizes[l - 1]; ++i) {
+                    Connect(network, neurons[l - 1][i], neurons[l][j],
+                            0.2 * static_cast<double>((i * 7 + j * 3 + l) % 9) - 0.8);
+                }
+            }
+        }
+        for (const auto& neuron : neurons[0]) {
+            network.SetInputMarker(neuron);
+        }
+        for (const auto& neuron : neurons[3]) {
+            network.SetOutputMarker(neuron);
+        }
+        const CompiledNetwork plan = network.Compile();
+        //全零输入时两层隐藏输出全为零，两个阶段都按散射形式执行
+        CompiledNetwork::InferenceContext context;
+        plan.Inference({0.0, 0.0, 0.0, 0.0}, context);
+        assert(context.ScatterStages == 2);
+        size_t scattered = 0;
+        std::vector<double> batchInput;
+        std::vector<double> expected;
+        for (size_t i = 0; i < 1200; ++i) {
+            const std::vector<double> input = {std::sin(0.37 * static_cast<double>(i)),
+                                               std::cos(0.11 * static_cast<double>(i)),
+                                               std::sin(0.05 * static_cast<double>(i) + 1.0),
+                                               0.5 * std::cos(0.23 * static_cast<double>(i))};
+            const auto reference = network.Inference(input);
+            const auto& actual = plan.Inference(input, context);
+            for (size_t k = 0; k < reference.size(); ++k) {
+                assert(std::fabs(actual[k] - reference[k]) < 1e-12);
+            }
+            assert(context.ScatterStages <= 2);
+            scattered += context.ScatterStages;
+            if (i < 200) {
+                batchInput.insert(batchInput.end(), input.begin(), input.end());
+                expected.insert(expected.end(), reference.begin(), reference.end());
+            }
+        }
+        assert(scattered > 1200);
+        std::vector<double> output(expected.size());
+        plan.InferenceBatch(batchInput.data(), 200, output.data());
+        for (size_t k = 0; k < output.size(); ++k) {
+            assert(std::fabs(output[k] - expected[k]) < 1e-12);
+        }
+    }
+
+    {
+        //剪枝：2-3-1网络，一个隐藏神经元没有通向输出的路径，一个零权重、一个极小权重突触
+        Network network;
+        auto inputLayer = std::make_shared<Layer>(0);
+        auto hiddenLayer = std::make_shared<Layer>(1);
+        auto outputLayer = std::make_shared<Layer>(2);
+        network.AddLayer(inputLayer);
+        network.AddLayer(hiddenLayer);
+        network.AddLayer(outputLayer);
+        std::vector<std::shared_ptr<Neuron>> in, hidden;
+        for (size_t i = 0; i < 2; ++i) {
+            in.push_back(std::make_shared<Neuron>(0.0, 0));
+            inputLayer->AddNeuron(in.back());
+            network.SetInputMarker(in.back());
+        }
+        for (size_t i = 0; i < 3; ++i) {
+            hidden.push_back(std::make_shared<Neuron>(0.1 * static_cast<double>(i), 1));
+            hiddenLayer->AddNeuron(hidden.back());
+        }
+        auto out = std::make_shared<Neuron>(-0.2, 2);
+        outputLayer->AddNeuron(out);
+        network.SetOutputMarker(out);
+        for (size_t i = 0; i < 2; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                Connect(network, in[i], hidden[j],
+                        (i == 1 && j == 0) ? 0.0 : 0.4 - 0.3 * static_cast<double>(i + j));
+            }
+        }
+        Connect(network, hidden[0], out, 0.9);
+        Connect(network, hidden[1], out, 1e-9);
+        const std::vector<double> input = {0.5, -1.5};
+        auto expected = network.Inference(input);
+        Network pruned;
+        pruned = network;
+        //阈值0：删除零权重突触与死神经元hidden[2]（含两条入边），结果不变
+        auto report = NetworkOptimizer::Prune(pruned, 0.0);
+        assert(report.NeuronsRemoved == 1);
+        assert(report.SynapsesRemoved == 3);
+        assert(report.FlopsBefore - report.FlopsAfter == 7);
+        assert(pruned.Inference(input)[0] == expected[0]);
+        //阈值1e-6：极小权重突触被删除后hidden[1]也不可达
+        report = NetworkOptimizer::Prune(pruned, 1e-6);
+        assert(report.NeuronsRemoved == 1);
+        assert(report.SynapsesRemoved == 3);
+        assert(pruned.IsValid());
+        assert(std::fabs(pruned.Inference(input)[0] - expected[0]) < 1e-8);
+    }
+
+    {
+        //剪枝后失去全部入边的神经元输出为常量：并入后继偏置后删除；常量输出神经元保留且网络仍合理
+        Network network;
+        auto inputLayer = std::make_shared<Layer>(0);
+        auto hiddenLayer = std::make_shared<Layer>(1);
+        auto outputLayer = std::make_shared<Layer>(2);
+        network.AddLayer(inputLayer);
+        network.AddLayer(hiddenLayer);
+        network.AddLayer(outputLayer);
+        auto in = std::make_shared<Neuron>(0.0, 0);
+        auto constant = std::make_shared<Neuron>(0.3, 1);
+        auto hidden = std::make_shared<Neuron>(-0.1, 2);
+        auto out = std::make_shared<Neuron>(0.2, 0);
+        auto fixed = std::make_shared<Neuron>(0.5, 2);
+        inputLayer->AddNeuron(in);
+        hiddenLayer->AddNeuron(constant);
+        hiddenLayer->AddNeuron(hidden);
+        outputLayer->AddNeuron(out);
+        outputLayer->AddNeuron(fixed);
+        Connect(network, in, constant, 0.0);
+        Connect(network, in, hidden, 0.5);
+        Connect(network, constant, out, 2.0);
+        Connect(network, hidden, out, 1.0);
+        Connect(network, constant, fixed, -1.5);
+        network.SetInputMarker(in);
+        network.SetOutputMarker(out);
+        network.SetOutputMarker(fixed);
+        Network pruned;
+        pruned = network;
+        auto report = NetworkOptimizer::Prune(pruned, 0.0);
+        assert(pruned.IsValid());
+        assert(report.NeuronsRemoved == 1);
+        for (double x : {-2.0, 0.0, 0.7}) {
+            auto expected = network.Inference({x});
+            auto actual = pruned.Inference({x});
+            assert(std::fabs(actual[0] - expected[0]) < 1e-12);
+            assert(std::fabs(actual[1] - expected[1]) < 1e-12);
+        }
+    }
     
+#if __cplusplus >= 202002L
+    {
+        //编译期网络：内嵌ANN文本在常量求值中解析，结果与导入的网络一致
+        static constexpr char ROTATION[] =
+            "G RotationNetwork\n"
+            "N 0.0 0\nN 0.0 0\nN 0.0 0\nN 0.0 0\nN 0.0 0\nN 0.0 0\n"
+            "L 0 2\nL 3 5\n"
+            "S -1 0 1.0\nS -1 1 1.0\nS -1 2 1.0\n"
+            "S 3 -1 1.0\nS 4 -1 1.0\nS 5 -1 1.0\n"
+            "S 0 3 0.3536\nS 0 4 -0.5732\nS 0 5 0.7392\n"
+            "S 1 3 0.6123\nS 1 4 0.7392\nS 1 5 0.2803\n"
+            "S 2 3 -0.7071\nS 2 4 0.3536\nS 2 5 0.6124\n";
+        constexpr auto fixed = FixedNetwork<3, 3>::Parse(ROTATION);
+        static_assert(fixed.WEIGHT_COUNT == 9);
+        static_assert(fixed.GetWeight(1, 2, 0) == 0.7392);
+        auto importer = Network_Importer::GetIstanceByExtName("ANN");
+        Network network = importer->LoadFromFile("simple.ANN");
+        auto expected = network.Inference({1.0, 2.0, 3.0});
+        auto actual = fixed.Inference({1.0, 2.0, 3.0});
+        for (size_t i = 0; i < actual.size(); ++i) {
+            assert(std::fabs(actual[i] - expected[i]) < 1e-12);
+        }
+    }
+#endif
+
     {
         //导入扩展名
         assert(Importer_test::GetExtName("simple.ANN") == "ANN");